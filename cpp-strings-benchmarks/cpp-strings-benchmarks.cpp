@@ -0,0 +1,265 @@
+/**
+	Library cppstrings
+	"What if c++ strings where as easy to use as Python strings?"
+	Benchmarks part of the library.
+
+	Copyright (C) 2025 Philippe Schmouker
+	contact - ph (dot) schmouker (at) gmail (dot) com
+
+	This program is free software: you can redistribute it and/or modify
+	it under the terms of the GNU General Public License as published by
+	the Free Software Foundation,  either version 3  of the License,  or
+	(at your option) any later version.
+
+	This program is distributed in the hope  that  it  will  be  useful,
+	but  WITHOUT  ANY  WARRANTY;  without  even  the implied warranty of
+	MERCHANTABILITY  or  FITNESS  FOR  A  PARTICULAR  PURPOSE.  See  the
+	GNU General Public License for more details.
+
+	You should have received a copy  of  the  GNU General Public License
+	along with this program.  If not, see <https://www.gnu.org/licenses/>.
+*/
+
+/*
+	Plain benchmarks, with no framework: every measure runs its code a few
+	times and prints the best time, in milliseconds, with its speed-up
+	against the reference measure of its group.
+
+	Build with optimizations on, e.g.:
+		g++ -std=c++23 -O2 -I../cpp-strings cpp-strings-benchmarks.cpp -o cpp-strings-benchmarks -ltbb
+	(libstdc++ runs the parallel execution policies on TBB, hence -ltbb).
+*/
+
+#define PCS_EXECUTION_POLICIES
+#include "cppstrings.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <execution>
+#include <format>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
+
+
+namespace
+{
+	volatile std::size_t sink;  // keeps results alive, so that benchmarked code cannot be optimized away
+
+	constexpr int REPEATS{ 5 };
+
+
+	/** \brief Runs func() REPEATS times and returns its best run time, in milliseconds. */
+	template<class FuncT>
+	double best_ms(FuncT&& func)
+	{
+		double best{ 1e300 };
+		for (int run = 0; run < REPEATS; ++run) {
+			const auto start{ std::chrono::steady_clock::now() };
+			func();
+			const std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+			best = std::min(best, elapsed.count());
+		}
+		return best;
+	}
+
+	/** \brief Sorts a fresh copy of strings REPEATS times and returns the best sort time, in milliseconds. */
+	template<class SortT>
+	double best_sort_ms(const std::vector<pcs::CppString>& strings, SortT&& sort)
+	{
+		double best{ 1e300 };
+		for (int run = 0; run < REPEATS; ++run) {
+			std::vector<pcs::CppString> copy{ strings };
+			const auto start{ std::chrono::steady_clock::now() };
+			sort(copy);
+			const std::chrono::duration<double, std::milli> elapsed{ std::chrono::steady_clock::now() - start };
+			best = std::min(best, elapsed.count());
+			sink = copy.front().size();
+		}
+		return best;
+	}
+
+	/** \brief Prints one measure and its speed-up against reference_ms. */
+	void report(const char* name, const double ms, const double reference_ms)
+	{
+		std::printf("    %-44s %10.3f ms   x%.2f\n", name, ms, reference_ms / ms);
+		std::fflush(stdout);
+	}
+
+	/** \brief Returns lines_count lines of comma separated random fields. */
+	pcs::CppString csv_text(const std::size_t lines_count)
+	{
+		std::mt19937 rng{ 42 };
+		std::uniform_int_distribution<int> letter('a', 'z');
+		std::uniform_int_distribution<int> field_len(1, 12);
+
+		pcs::CppString text;
+		for (std::size_t line = 0; line < lines_count; ++line) {
+			for (int field = 0; field < 8; ++field) {
+				if (field > 0)
+					text += ',';
+				for (int n = field_len(rng); n > 0; --n)
+					text += char(letter(rng));
+			}
+			text += '\n';
+		}
+		return text;
+	}
+
+	/** \brief Returns count URLs, sharing a few hosts and long path prefixes. */
+	std::vector<pcs::CppString> url_strings(const std::size_t count)
+	{
+		static const char* const hosts[]{ "https://www.example.com/", "https://docs.example.org/", "http://shop.example.net/" };
+		static const char* const dirs[]{ "products/", "articles/2024/", "articles/2025/", "users/profile/", "static/images/" };
+		std::mt19937 rng{ 42 };
+		std::uniform_int_distribution<int> host(0, 2);
+		std::uniform_int_distribution<int> dir(0, 4);
+		std::uniform_int_distribution<int> id(0, 999'999);
+
+		std::vector<pcs::CppString> urls;
+		urls.reserve(count);
+		for (std::size_t i = 0; i < count; ++i)
+			urls.emplace_back(std::format("{}{}item-{}.html", hosts[host(rng)], dirs[dir(rng)], id(rng)));
+		return urls;
+	}
+
+	/** \brief Returns count strings of 1 to 32 random letters. */
+	std::vector<pcs::CppString> random_strings(const std::size_t count)
+	{
+		std::mt19937 rng{ 42 };
+		std::uniform_int_distribution<int> letter('a', 'z');
+		std::uniform_int_distribution<int> len(1, 32);
+
+		std::vector<pcs::CppString> strings(count);
+		for (auto& str : strings)
+			for (int n = len(rng); n > 0; --n)
+				str += char(letter(rng));
+		return strings;
+	}
+
+
+	//---   single character arguments   ---------------------
+	void bench_single_char()
+	{
+		std::printf("\nsingle character vs. one-character string arguments\n");
+		std::fflush(stdout);
+
+		pcs::CppString text{ csv_text(100'000) };  // not const: split(sep) is not a const method
+		const pcs::CppString short_text{ csv_text(1'000) };  // count(sub) and find(sub, start) copy the searched characters at each call
+		const std::vector<pcs::CppString> lines{ text.splitlines() };
+		const pcs::CppString comma{ "," };
+		const pcs::CppString semicolon{ ";" };
+		const pcs::CppString zed{ "z" };
+
+		double ref{ best_ms([&] { sink = short_text.count(comma); }) };
+		report("count(\",\") on a shorter text", ref, ref);
+		report("count(',') on a shorter text", best_ms([&] { sink = short_text.count(','); }), ref);
+
+		ref = best_ms([&] {
+			std::size_t n{ 0 };
+			for (std::size_t pos = short_text.find(comma); pos != pcs::CppString::npos; pos = short_text.find(comma, pos + 1))
+				++n;
+			sink = n;
+		});
+		report("find(\",\") loop on a shorter text", ref, ref);
+		report("find(',') loop on a shorter text", best_ms([&] {
+			std::size_t n{ 0 };
+			for (std::size_t pos = short_text.find(','); pos != pcs::CppString::npos; pos = short_text.find(',', pos + 1))
+				++n;
+			sink = n;
+		}), ref);
+
+		ref = best_ms([&] { sink = text.split(comma).size(); });
+		report("split(\",\")", ref, ref);
+		report("split(',')", best_ms([&] { sink = text.split(',').size(); }), ref);
+
+		ref = best_ms([&] { sink = text.replace(comma, semicolon).size(); });
+		report("replace(\",\", \";\")", ref, ref);
+		report("replace(',', ';')", best_ms([&] { sink = text.replace(',', ';').size(); }), ref);
+
+		ref = best_ms([&] { std::size_t n{ 0 }; for (const auto& line : lines) n += line.partition(comma)[0].size(); sink = n; });
+		report("partition(\",\") on each line", ref, ref);
+		report("partition(',') on each line", best_ms([&] { std::size_t n{ 0 }; for (const auto& line : lines) n += line.partition(',')[0].size(); sink = n; }), ref);
+
+		ref = best_ms([&] { std::size_t n{ 0 }; for (const auto& line : lines) n += line.strip(zed).size(); sink = n; });
+		report("strip(\"z\") on each line", ref, ref);
+		report("strip('z') on each line", best_ms([&] { std::size_t n{ 0 }; for (const auto& line : lines) n += line.strip('z').size(); sink = n; }), ref);
+	}
+
+
+	//---   parallel searches scaling   ----------------------
+	void bench_parallel_scaling()
+	{
+		const std::size_t max_threads{ std::max(1u, std::thread::hardware_concurrency()) };
+		std::printf("\nparallel find(), count() and contains() from 1 to %zu threads\n", max_threads);
+		std::fflush(stdout);
+
+		const pcs::CppString text{ csv_text(1'000'000) };
+		const pcs::CppString sub{ "abc," };  // a few hundreds of occurrences in 60 MB
+		const pcs::CppString last{ text.substr(text.size() - 20, 19) };  // found at the very end of text only
+		const pcs::CppString absent{ "#none#" };
+
+		std::vector<std::size_t> threads_counts;
+		for (std::size_t n = 1; n < max_threads; n *= 2)
+			threads_counts.push_back(n);
+		threads_counts.push_back(max_threads);
+
+		char name[64];
+		const double count_ref{ best_ms([&] { sink = text.count(std::execution::par, sub, 1); }) };
+		for (const std::size_t n : threads_counts) {
+			std::snprintf(name, sizeof name, "count(par, \"abc,\"), %zu thread(s)", n);
+			report(name, best_ms([&] { sink = text.count(std::execution::par, sub, n); }), count_ref);
+		}
+
+		const double find_ref{ best_ms([&] { sink = text.find(std::execution::par, last, 1); }) };
+		for (const std::size_t n : threads_counts) {
+			std::snprintf(name, sizeof name, "find(par, last chars), %zu thread(s)", n);
+			report(name, best_ms([&] { sink = text.find(std::execution::par, last, n); }), find_ref);
+		}
+
+		const double contains_ref{ best_ms([&] { sink = text.contains(std::execution::par, absent, 1); }) };
+		for (const std::size_t n : threads_counts) {
+			std::snprintf(name, sizeof name, "contains(par, absent), %zu thread(s)", n);
+			report(name, best_ms([&] { sink = text.contains(std::execution::par, absent, n); }), contains_ref);
+		}
+	}
+
+
+	//---   strings sorting   --------------------------------
+	void bench_sort_strings()
+	{
+		const std::pair<const char*, std::vector<pcs::CppString>> datasets[]{
+			{ "URL-like", url_strings(500'000) },
+			{ "random", random_strings(500'000) }
+		};
+
+		for (const auto& [data_name, strings] : datasets) {
+			std::printf("\nsort_strings() vs. std::sort(), 500000 %s strings\n", data_name);
+			std::fflush(stdout);
+
+			double ref{ best_sort_ms(strings, [](auto& v) { std::sort(v.begin(), v.end()); }) };
+			report("std::sort()", ref, ref);
+			report("sort_strings()", best_sort_ms(strings, [](auto& v) { pcs::sort_strings(v); }), ref);
+
+			ref = best_sort_ms(strings, [](auto& v) { std::stable_sort(v.begin(), v.end()); });
+			report("std::stable_sort()", ref, ref);
+			report("sort_strings(stable)", best_sort_ms(strings, [](auto& v) { pcs::sort_strings(v, true); }), ref);
+
+			ref = best_sort_ms(strings, [](auto& v) { std::sort(std::execution::par, v.begin(), v.end()); });
+			report("std::sort(par)", ref, ref);
+			report("sort_strings(par)", best_sort_ms(strings, [](auto& v) { pcs::sort_strings(std::execution::par, v); }), ref);
+		}
+	}
+
+}
+
+
+int main()
+{
+	bench_single_char();
+	bench_parallel_scaling();
+	bench_sort_strings();
+	return 0;
+}
@@ -24,7 +24,11 @@
 
 using namespace Microsoft::VisualStudio::CppUnitTestFramework;
 
+#define PCS_EXECUTION_POLICIES
 #include "cppstrings.h"
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
 
 
 namespace cppstringstests
@@ -2070,6 +2074,27 @@ namespace cppstringstests
 			Assert::AreEqual(pcs::CppWString(L"zyxwvutsrqp").c_str(), ws.center(10, L'#').c_str(), L"--16--");
 		}
 
+		TEST_METHOD(center_into)
+		{
+			pcs::CppString s("abc");
+			std::array<char, 16> buf{};
+			Assert::AreEqual(std::size_t(7), s.center_into(std::span(buf), 7, '*'));
+			Assert::AreEqual("**abc**", pcs::CppString(buf.data()).c_str());
+
+			std::array<char, 4> small{};
+			Assert::AreEqual(std::size_t(7), s.center_into(std::span(small), 7, '*'));
+			Assert::AreEqual(pcs::CppString("**ab").c_str(), pcs::CppString(small.data(), small.size()).c_str());
+
+			pcs::CppString res("pre:");
+			s.center_into(std::back_inserter(res), 6);
+			Assert::AreEqual("pre: abc  ", res.c_str());
+
+			pcs::CppWString ws(L"abc");
+			pcs::CppWString wres;
+			ws.center_into(std::back_inserter(wres), 2);
+			Assert::AreEqual(L"abc", wres.c_str());
+		}
+
 		TEST_METHOD(contains)
 		{
 			using namespace pcs;
@@ -2128,6 +2153,34 @@ namespace cppstringstests
 			Assert::IsFalse(wtext.contains(L'a'));
 		}
 
+		TEST_METHOD(contains_ch)
+		{
+			pcs::CppString s("abcd,efg");
+			Assert::IsTrue(s.contains(','));
+			Assert::IsTrue(s.contains('a'));
+			Assert::IsTrue(s.contains('g'));
+			Assert::IsFalse(s.contains('z'));
+			Assert::IsFalse(pcs::CppString().contains('a'));
+
+			pcs::CppWString ws(L"abcd,efg");
+			Assert::IsTrue(ws.contains(L','));
+			Assert::IsFalse(ws.contains(L'z'));
+		}
+
+		TEST_METHOD(contains_parallel)
+		{
+			pcs::CppString text(4 * pcs::PARALLEL_MIN_CHARS + 5, 'a');
+			Assert::IsFalse(text.contains(std::execution::par, "ab", 4));
+			text[3 * pcs::PARALLEL_MIN_CHARS - 1] = 'b';
+			Assert::IsTrue(text.contains(std::execution::par, "ab", 4));
+			Assert::IsTrue(text.contains(std::execution::par, "aba", 4));
+			Assert::IsTrue(text.contains(std::execution::par_unseq, "", 4));
+			Assert::IsFalse(text.contains(std::execution::seq, "bb"));
+
+			Assert::IsTrue(pcs::CppString("abcd").contains(std::execution::par, "bc"));
+			Assert::IsTrue(pcs::CppWString(L"abcd").contains(std::execution::par, L"cd"));
+		}
+
 		TEST_METHOD(contains_n)
 		{
 			using namespace pcs;
@@ -2235,6 +2288,50 @@ namespace cppstringstests
 			Assert::AreEqual(pcs::CppString::size_type(0), ws.count(L"A", 3, s.size() + 4));
 		}
 
+		TEST_METHOD(count_ch)
+		{
+			pcs::CppString s("a,b,,c,d,e,f,g,h,i,j,k,l,m,n,o,p,");
+			Assert::AreEqual(s.count(pcs::CppString(",")), s.count(','));
+			Assert::AreEqual(std::size_t(17), s.count(','));
+			Assert::AreEqual(std::size_t(1), s.count('a'));
+			Assert::AreEqual(std::size_t(0), s.count('z'));
+			Assert::AreEqual(std::size_t(2), s.count(',', 1, 3));
+			Assert::AreEqual(std::size_t(3), s.count(',', 1, 4));
+			Assert::AreEqual(std::size_t(0), s.count(',', 40));
+
+			for (std::size_t len = 0; len < 40; ++len) {
+				const pcs::CppString t(len, '\xff');
+				for (std::size_t start = 0; start < len; ++start)
+					Assert::AreEqual(len - start, t.count('\xff', start));
+				Assert::AreEqual(std::size_t(0), t.count('\x7f'));
+			}
+
+			pcs::CppWString ws(L"a,b,,c");
+			Assert::AreEqual(std::size_t(3), ws.count(L','));
+		}
+
+		TEST_METHOD(count_parallel)
+		{
+			// 4 chunks of 1 << 16 chars, occurrences straddling the chunks bounds
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString(index % 5, 'a') + "b";
+			for (const std::size_t bound : { std::size_t(1) << 16, std::size_t(2) << 16, std::size_t(3) << 16 })
+				text[bound] = text[bound - 1] = text[bound - 2] = 'a';
+
+			for (const pcs::CppString sub : { "a", "aa", "aaa", "ab", "aba", "bab", "x" }) {
+				std::size_t expected{ 0 };
+				for (std::size_t pos = 0; (pos = text.std::string::find(sub, pos)) != std::string::npos; pos += sub.size())
+					++expected;
+				Assert::AreEqual(expected, text.count(std::execution::par, sub, 4));
+				Assert::AreEqual(expected, text.count(std::execution::par_unseq, sub, 3));
+				Assert::AreEqual(expected, text.count(std::execution::seq, sub));
+			}
+
+			Assert::AreEqual(std::size_t(2), pcs::CppString("aaaaa").count(std::execution::par, "aa"));
+			Assert::AreEqual(std::size_t(2), pcs::CppWString(L"abab").count(std::execution::par, L"ab"));
+		}
+
 		TEST_METHOD(count_n)
 		{
 			pcs::CppString s("abcabcabcdefabca bca bcabca");
@@ -2262,6 +2359,18 @@ namespace cppstringstests
 			Assert::AreEqual(pcs::CppString::size_type(0), ws.count_n(L"A", 3, wlen + 4));
 		}
 
+		TEST_METHOD(delete_chars)
+		{
+			const pcs::CharSet punct(".,;:!?");
+			Assert::AreEqual("Hello world", pcs::CppString("Hello, world!").delete_chars(punct).c_str());
+			Assert::AreEqual("", pcs::CppString("...").delete_chars(punct).c_str());
+			Assert::AreEqual("abc", pcs::CppString("abc").delete_chars(punct).c_str());
+			Assert::AreEqual("", pcs::CppString().delete_chars(punct).c_str());
+			Assert::AreEqual("bd", pcs::CppString("abcdac").delete_chars("ac").c_str());
+
+			Assert::AreEqual(L"x\u00e9", pcs::CppWString(L"\u2014x\u00e9\u2014").delete_chars(pcs::WCharSet(L"\u2014")).c_str());
+		}
+
 		TEST_METHOD(endswith)
 		{
 			pcs::CppString s("abcabcabcdefabca bca bcabca");
@@ -2335,6 +2444,64 @@ namespace cppstringstests
 			Assert::AreEqual(pcs::CppWString(L"a bc def ghij \r k\nl m\r\nno pqr  s.").c_str(), wts.c_str());
 		}
 
+		TEST_METHOD(expand_tabs_inplace)
+		{
+			pcs::CppString s("a\tbc\tdef\tghij\t\r\tk\nl\tm\r\nno\tpqr \ts.");
+			pcs::CppString expected{ s.expand_tabs(4) };
+			s.reserve(64);
+			const char* const data{ s.data() };
+			Assert::AreEqual(expected.c_str(), s.expand_tabs_inplace(4).c_str());
+			Assert::IsTrue(data == s.data());
+
+			pcs::CppString long_line("a long line with\ttabs \t\tand some text after them\n\t.");
+			expected = long_line.expand_tabs(8);
+			Assert::AreEqual(expected.c_str(), long_line.expand_tabs_inplace().c_str());
+			Assert::AreEqual("no tab", pcs::CppString("no tab").expand_tabs_inplace().c_str());
+			Assert::AreEqual(" ", pcs::CppString("\t").expand_tabs_inplace(1).c_str());
+
+			pcs::CppWString ws(L"\tx\ty\r\n\t");
+			Assert::AreEqual(L"  x y\r\n  ", ws.expand_tabs_inplace(2).c_str());
+		}
+
+		TEST_METHOD(expand_tabs_into)
+		{
+			pcs::CppString s("a\tbc\n\td");
+			std::array<char, 32> buf{};
+			const std::size_t n{ s.expand_tabs_into(std::span(buf), 4) };
+			Assert::AreEqual(s.expand_tabs(4).c_str(), pcs::CppString(buf.data(), n).c_str());
+
+			std::array<char, 2> small{};
+			Assert::AreEqual(n, s.expand_tabs_into(std::span(small), 4));
+			Assert::AreEqual('a', small[0]);
+			Assert::AreEqual(' ', small[1]);
+
+			pcs::CppWString ws(L"\tx");
+			pcs::CppWString wres;
+			ws.expand_tabs_into(std::back_inserter(wres), 2);
+			Assert::AreEqual(L"  x", wres.c_str());
+		}
+
+		TEST_METHOD(expand_tabs_parallel)
+		{
+			// 4 chunks of 1 << 16 chars, lines spanning several chunks
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index) {
+				text += pcs::CppString(index % 13, 'x') + '\t';
+				if (index % 3001 == 0)
+					text += (index % 2 == 0) ? '\n' : '\r';
+			}
+			text[(std::size_t(1) << 16) - 1] = '\t';
+			text[std::size_t(2) << 16] = '\n';
+
+			for (const std::size_t tabsize : { 0, 1, 4, 8, 11 }) {
+				Assert::IsTrue(text.expand_tabs(tabsize) == text.expand_tabs(std::execution::par, tabsize, 4));
+				Assert::IsTrue(text.expand_tabs(tabsize) == text.expand_tabs(std::execution::par_unseq, tabsize, 3));
+			}
+
+			Assert::AreEqual("a   b\n    c", pcs::CppString("a\tb\n\tc").expand_tabs(std::execution::par, 4).c_str());
+			Assert::AreEqual(L"a       b", pcs::CppWString(L"a\tb").expand_tabs(std::execution::seq).c_str());
+		}
+
 		TEST_METHOD(find)
 		{
 			size_t found_pos;
@@ -2451,6 +2618,53 @@ namespace cppstringstests
 			Assert::AreEqual(size_t(13), wtest.find(L".", 13));
 		}
 
+		TEST_METHOD(find_ch)
+		{
+			pcs::CppString s("ab,cd,ef");
+			Assert::AreEqual(std::size_t(2), s.find(','));
+			Assert::AreEqual(std::size_t(5), s.find(',', 3));
+			Assert::AreEqual(std::size_t(5), s.find(',', 3, 5));
+			Assert::AreEqual(pcs::CppString::npos, s.find(',', 3, 4));
+			Assert::AreEqual(pcs::CppString::npos, s.find(',', 6));
+			Assert::AreEqual(pcs::CppString::npos, s.find(',', 20));
+			Assert::AreEqual(pcs::CppString::npos, s.find('z'));
+			Assert::AreEqual(std::size_t(0), s.find('a'));
+
+			pcs::CppWString ws(L"ab,cd,ef");
+			Assert::AreEqual(std::size_t(5), ws.find(L',', 3));
+		}
+
+		TEST_METHOD(find_parallel)
+		{
+			pcs::CppString text(4 * pcs::PARALLEL_MIN_CHARS + 5, 'a');
+			Assert::AreEqual(pcs::CppString::npos, text.find(std::execution::par, "b", 4));
+			text[3 * pcs::PARALLEL_MIN_CHARS + 7] = 'b';
+			text[2 * pcs::PARALLEL_MIN_CHARS] = 'b';
+			Assert::AreEqual(2 * pcs::PARALLEL_MIN_CHARS - 2, text.find(std::execution::par, "aab", 4));
+			Assert::AreEqual(2 * pcs::PARALLEL_MIN_CHARS, text.find(std::execution::par, "b", 4));
+			Assert::AreEqual(2 * pcs::PARALLEL_MIN_CHARS, text.find(std::execution::par_unseq, "ba", 3));
+			Assert::AreEqual(std::size_t(0), text.find(std::execution::par, "aaaa", 4));
+			Assert::AreEqual(2 * pcs::PARALLEL_MIN_CHARS - 1, text.find(std::execution::seq, "ab"));
+
+			Assert::AreEqual(std::size_t(1), pcs::CppString("abcd").find(std::execution::par, "bc"));
+			Assert::AreEqual(std::size_t(2), pcs::CppWString(L"abcd").find(std::execution::par, L"cd"));
+		}
+
+		TEST_METHOD(find_any)
+		{
+			const pcs::CharSet seps("/?#");
+			pcs::CppString s("http://host/path?q#f");
+			Assert::AreEqual(std::size_t(5), s.find_any(seps));
+			Assert::AreEqual(std::size_t(11), s.find_any(seps, 7));
+			Assert::AreEqual(std::size_t(16), s.find_any(seps, 12, 16));
+			Assert::AreEqual(pcs::CppString::npos, s.find_any(seps, 12, 15));
+			Assert::AreEqual(pcs::CppString::npos, s.find_any(pcs::CharSet("xyz")));
+			Assert::AreEqual(pcs::CppString::npos, s.find_any(seps, 40));
+
+			pcs::CppWString ws(L"a\u3000b");
+			Assert::AreEqual(std::size_t(1), ws.find_any(pcs::WCharSet::whitespaces()));
+		}
+
 		TEST_METHOD(find_n)
 		{
 			size_t found_pos;
@@ -2587,6 +2801,164 @@ namespace cppstringstests
 			Assert::AreEqual(L"56 3.1415927abc.", (ws.format(L"{}{}{:10.7f}{:s}", x, y, pi, wt)).c_str());
 		}
 
+		TEST_METHOD(format_aliasing)
+		{
+			pcs::CppString s("abc");
+			s.format("[{}]", static_cast<const std::string&>(s));
+			Assert::AreEqual("[abc]", s.c_str());
+
+			s.reserve(100);
+			const char* const data{ s.data() };
+			s.format("{:>10}", 42);
+			Assert::AreEqual("        42", s.c_str());
+			Assert::IsTrue(data == s.data());
+		}
+
+		TEST_METHOD(format_append)
+		{
+			pcs::CppString s("x=");
+			Assert::AreEqual("x=1, y=2.5", s.format_append("{}, y={}", 1, 2.5).c_str());
+			s.clear();
+			Assert::AreEqual("abc|  7", s.format_append("{}", "abc").format_append("|{:>3}", 7).c_str());
+
+			pcs::CppWString ws(L"w");
+			Assert::AreEqual(L"w:0x1f", ws.format_append(L":{:#x}", 31).c_str());
+		}
+
+		TEST_METHOD(format_utf)
+		{
+			pcs::CppStringT<char8_t> s8;
+			s8.format("{}-{}", 12, "h\xc3\xa9");
+			Assert::IsTrue(s8 == u8"12-h\u00e9");
+			s8.format_append("!");
+			Assert::IsTrue(s8 == u8"12-h\u00e9!");
+			s8.format("a{}b\xc3", "\xff\xc0\xaf").format_append("\xe2\x82\xac\xe2\x82");
+			Assert::IsTrue(s8 == u8"a\ufffd\ufffd\ufffdb\ufffd\u20ac\ufffd\ufffd");
+
+			pcs::CppStringT<char16_t> s16;
+			s16.format("{} \xf0\x9f\x98\x80 \xe2\x82\xac{}", 3.5, "\xff");
+			Assert::IsTrue(s16 == u"3.5 \U0001F600 \u20ac\ufffd");
+
+			pcs::CppStringT<char32_t> s32;
+			s32.format("{}\xe2\x82\xac", 'x').format_append("{:03}", 7);
+			Assert::IsTrue(s32 == U"x\u20ac007");
+			s32.format("\xc0\xaf{}", "\xed\xa0\x80");
+			Assert::IsTrue(s32 == U"\ufffd\ufffd\ufffd\ufffd\ufffd");
+		}
+
+		TEST_METHOD(formatter)
+		{
+			const pcs::CppString s("abc");
+			Assert::AreEqual("abc", std::format("{}", s).c_str());
+			Assert::AreEqual("abc  ", std::format("{:5}", s).c_str());
+			Assert::AreEqual("  abc", std::format("{:>5}", s).c_str());
+			Assert::AreEqual(" abc  ", std::format("{:^6}", s).c_str());
+			Assert::AreEqual("**abc***", std::format("{:*^8}", s).c_str());
+			Assert::AreEqual("abc00", std::format("{:05}", s).c_str());
+			Assert::AreEqual("00abc", std::format("{:>05}", s).c_str());
+			Assert::AreEqual("ab", std::format("{:.2}", s).c_str());
+			Assert::AreEqual("ab--", std::format("{:-<{}.{}s}", s, 4, 2).c_str());
+			Assert::AreEqual("  abc", std::format("{0:>{1}}", s, 5).c_str());
+
+			Assert::AreEqual("'abc'", std::format("{:r}", s).c_str());
+			Assert::AreEqual("\"it's\"", std::format("{:r}", pcs::CppString("it's")).c_str());
+			Assert::AreEqual("'a\"b\\'c'", std::format("{:r}", pcs::CppString("a\"b'c")).c_str());
+			Assert::AreEqual("'t\\tn\\n\\x01\\x7f\\\\'", std::format("{:r}", pcs::CppString("t\tn\n\x01\x7f\\")).c_str());
+			Assert::AreEqual("  'ab", std::format("{:>5.3r}", s).c_str());
+
+			// widths and precisions in code points, multi-bytes fill characters
+			const pcs::CppString utf8("h\xc3\xa9");
+			Assert::AreEqual("\xc3\x97h\xc3\xa9\xc3\x97\xc3\x97", std::format("{:\xc3\x97^5}", utf8).c_str());
+			Assert::AreEqual("h\xc3\xa9", std::format("{:.2}", pcs::CppString("h\xc3\xa9llo")).c_str());
+
+			const pcs::CppWString ws(L"xy");
+			Assert::AreEqual(L"..xy", std::format(L"{:.>4}", ws).c_str());
+			Assert::AreEqual(L"'x\\ty'", std::format(L"{:r}", pcs::CppWString(L"x\ty")).c_str());
+
+			pcs::CppString res;
+			Assert::AreEqual("[  abc   ]", res.format("[{:^8}]", s).c_str());
+		}
+
+		TEST_METHOD(from_number)
+		{
+			Assert::AreEqual("42", pcs::CppString::from_number(42).c_str());
+			Assert::AreEqual("-128", pcs::CppString::from_number(std::int8_t(-128)).c_str());
+			Assert::AreEqual("ff", pcs::CppString::from_number(255u, 16).c_str());
+			Assert::AreEqual("-101", pcs::CppString::from_number(-5LL, 2).c_str());
+			Assert::AreEqual(L"1234567890123", pcs::CppWString::from_number(1234567890123ULL).c_str());
+			Assert::AreEqual("z", pcs::CppString::from_number(35, 36).c_str());
+			for (const int base : { -2, 0, 1, 37 })
+				Assert::ExpectException<pcs::CppString::ValueException>([base] { (void)pcs::CppString::from_number(10, base); });
+
+			Assert::AreEqual("1.5", pcs::CppString::from_number(1.5).c_str());
+			Assert::AreEqual("100.0", pcs::CppString::from_number(100.0).c_str());
+			Assert::AreEqual("-0.0", pcs::CppString::from_number(-0.0).c_str());
+			Assert::AreEqual("0.1", pcs::CppString::from_number(0.1).c_str());
+			Assert::AreEqual("0.1", pcs::CppString::from_number(0.1f).c_str());
+			Assert::AreEqual("0.0001", pcs::CppString::from_number(0.0001).c_str());
+			Assert::AreEqual("1.5e-05", pcs::CppString::from_number(1.5e-5).c_str());
+			Assert::AreEqual("1000000000000000.0", pcs::CppString::from_number(1e15).c_str());
+			Assert::AreEqual("1e+16", pcs::CppString::from_number(1e16).c_str());
+			Assert::AreEqual("-2.5e+100", pcs::CppString::from_number(-2.5e100).c_str());
+			Assert::AreEqual("5e-324", pcs::CppString::from_number(5e-324).c_str());
+			Assert::AreEqual("inf", pcs::CppString::from_number(std::numeric_limits<double>::infinity()).c_str());
+			Assert::AreEqual("-inf", pcs::CppString::from_number(-std::numeric_limits<double>::infinity()).c_str());
+			Assert::AreEqual("nan", pcs::CppString::from_number(std::numeric_limits<double>::quiet_NaN()).c_str());
+			Assert::AreEqual(L"12.25", pcs::CppWString::from_number(12.25).c_str());
+
+			Assert::AreEqual("3.14", pcs::CppString::from_number(3.14159, std::chars_format::fixed, 2).c_str());
+			Assert::AreEqual("1.000e+03", pcs::CppString::from_number(1000.0, std::chars_format::scientific, 3).c_str());
+			Assert::AreEqual(std::size_t(304), pcs::CppString::from_number(1e300, std::chars_format::fixed, 2).size());
+
+			for (const double value : { 0.1, 1.0 / 3.0, 123456.789, 6.02214076e23, 1.7976931348623157e308, 2.2250738585072014e-308 })
+				Assert::AreEqual(value, pcs::CppString::from_number(value).to_float());
+		}
+
+		TEST_METHOD(icount)
+		{
+			const pcs::CppString s("Abc aBC abc-ABC.\xc3\x89");
+			Assert::AreEqual(std::size_t(4), s.icount("abc"));
+			Assert::AreEqual(std::size_t(3), s.icount("ABC", 1));
+			Assert::AreEqual(std::size_t(2), s.icount("Abc", 1, 10));
+			Assert::AreEqual(std::size_t(2), pcs::CppString("aAaAa").icount("AA"));
+			Assert::AreEqual(std::size_t(1), s.icount("\xc3\x89"));
+			Assert::AreEqual(std::size_t(0), s.icount("\xc3\xa9"));
+			Assert::AreEqual(std::size_t(4), pcs::CppString("abc").icount(""));
+			Assert::AreEqual(std::size_t(0), s.icount("abc", 30));
+
+			const pcs::CppWString ws(L"Xy xY XY");
+			Assert::AreEqual(std::size_t(3), ws.icount(L"xy"));
+		}
+
+		TEST_METHOD(iendswith)
+		{
+			const pcs::CppString s("Report.PDF");
+			Assert::IsTrue(s.iendswith(".pdf"));
+			Assert::IsTrue(s.iendswith("PORT", 0, 5));
+			Assert::IsFalse(s.iendswith(".pdf", 0, 8));
+			Assert::IsFalse(s.iendswith("a report.pdf"));
+			Assert::IsTrue(s.iendswith(""));
+			Assert::IsTrue(pcs::CppWString(L"Data.CSV").iendswith(L".csv"));
+		}
+
+		TEST_METHOD(ifind)
+		{
+			const pcs::CppString s("The Quick brown FOX jumps over the lazy fox");
+			Assert::AreEqual(std::size_t(16), s.ifind("fox"));
+			Assert::AreEqual(std::size_t(40), s.ifind("FOX", 17));
+			Assert::AreEqual(pcs::CppString::npos, s.ifind("fox", 17, 41));
+			Assert::AreEqual(std::size_t(0), s.ifind("tHE"));
+			Assert::AreEqual(std::size_t(31), s.ifind("THE", 1));
+			Assert::AreEqual(std::size_t(4), s.ifind("quick BROWN"));
+			Assert::AreEqual(pcs::CppString::npos, s.ifind("foxes"));
+			Assert::AreEqual(std::size_t(3), s.ifind("", 3));
+			Assert::AreEqual(pcs::CppString::npos, s.ifind("fox", 50));
+			Assert::AreEqual(pcs::CppString(s).lower().find("jumps over"), s.ifind(pcs::CppString("JUMPS OVER")));
+
+			const pcs::CppWString ws(L"Hello World");
+			Assert::AreEqual(std::size_t(6), ws.ifind(L"wORLD"));
+		}
+
 		TEST_METHOD(index_char)
 		{
 			using string_type = pcs::CppString;
@@ -3022,6 +3394,19 @@ namespace cppstringstests
 			}
 		}
 
+		TEST_METHOD(istartswith)
+		{
+			const pcs::CppString s("Content-Type: text/html");
+			Assert::IsTrue(s.istartswith("content-type"));
+			Assert::IsTrue(s.istartswith("TYPE", 8));
+			Assert::IsTrue(s.istartswith("TEXT", 14, 17));
+			Assert::IsFalse(s.istartswith("TEXT/", 14, 17));
+			Assert::IsFalse(s.istartswith("content-length"));
+			Assert::IsTrue(s.istartswith(""));
+			Assert::IsFalse(s.istartswith("", 30));
+			Assert::IsTrue(pcs::CppWString(L"GET /").istartswith(L"get"));
+		}
+
 		TEST_METHOD(istitle)
 		{
 			pcs::CppString s("abc, defgh ijklm nop. qrs 1 tuvwx2345 = yz!");
@@ -3113,25 +3498,40 @@ namespace cppstringstests
 			Assert::AreEqual("abc", s.ljust(1).c_str());
 			Assert::AreEqual("abc", s.ljust(2).c_str());
 			Assert::AreEqual("abc", s.ljust(3).c_str());
-			Assert::AreEqual(" abc", s.ljust(4).c_str());
-			Assert::AreEqual("  abc", s.ljust(5).c_str());
+			Assert::AreEqual("abc ", s.ljust(4).c_str());
+			Assert::AreEqual("abc  ", s.ljust(5).c_str());
 			Assert::AreEqual("abc", s.ljust(1).c_str());
 			Assert::AreEqual("abc", s.ljust(2).c_str());
 			Assert::AreEqual("abc", s.ljust(3).c_str());
-			Assert::AreEqual(".abc", s.ljust(4, '.').c_str());
-			Assert::AreEqual("..abc", s.ljust(5, '.').c_str());
+			Assert::AreEqual("abc.", s.ljust(4, '.').c_str());
+			Assert::AreEqual("abc..", s.ljust(5, '.').c_str());
 
 			pcs::CppWString ws(L"abc");
 			Assert::AreEqual(L"abc", ws.ljust(1).c_str());
 			Assert::AreEqual(L"abc", ws.ljust(2).c_str());
 			Assert::AreEqual(L"abc", ws.ljust(3).c_str());
-			Assert::AreEqual(L" abc", ws.ljust(4).c_str());
-			Assert::AreEqual(L"  abc", ws.ljust(5).c_str());
+			Assert::AreEqual(L"abc ", ws.ljust(4).c_str());
+			Assert::AreEqual(L"abc  ", ws.ljust(5).c_str());
 			Assert::AreEqual(L"abc", ws.ljust(1).c_str());
 			Assert::AreEqual(L"abc", ws.ljust(2).c_str());
 			Assert::AreEqual(L"abc", ws.ljust(3).c_str());
-			Assert::AreEqual(L".abc", ws.ljust(4, '.').c_str());
-			Assert::AreEqual(L"..abc", ws.ljust(5, '.').c_str());
+			Assert::AreEqual(L"abc.", ws.ljust(4, '.').c_str());
+			Assert::AreEqual(L"abc..", ws.ljust(5, '.').c_str());
+		}
+
+		TEST_METHOD(ljust_into)
+		{
+			pcs::CppString s("abc");
+			std::array<char, 8> buf{};
+			Assert::AreEqual(s.ljust(6, '.').size(), s.ljust_into(std::span(buf), 6, '.'));
+			Assert::AreEqual(s.ljust(6, '.').c_str(), pcs::CppString(buf.data()).c_str());
+			Assert::AreEqual("abc...", pcs::CppString(buf.data()).c_str());
+			Assert::AreEqual(std::size_t(3), s.ljust_into(std::span(buf), 2));
+
+			pcs::CppWString ws(L"abc");
+			pcs::CppWString wres;
+			ws.ljust_into(std::back_inserter(wres), 5, L'#');
+			Assert::AreEqual(ws.ljust(5, L'#').c_str(), wres.c_str());
 		}
 
 		TEST_METHOD(lower)
@@ -3184,6 +3584,35 @@ namespace cppstringstests
 
 		}
 
+		TEST_METHOD(lower_into)
+		{
+			const pcs::CppString s("AbC dE");
+			std::array<char, 8> buf{};
+			Assert::AreEqual(std::size_t(6), s.lower_into(std::span(buf)));
+			Assert::AreEqual("abc de", pcs::CppString(buf.data()).c_str());
+			Assert::AreEqual("AbC dE", s.c_str());
+
+			pcs::CppWString wres;
+			pcs::CppWString(L"XyZ").lower_into(std::back_inserter(wres));
+			Assert::AreEqual(L"xyz", wres.c_str());
+		}
+
+		TEST_METHOD(lower_parallel)
+		{
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString("Some Mixed-Case TEXT, line ") + char('a' + index % 26) + "\n";
+			pcs::CppString expected(text);
+			expected.lower();
+			pcs::CppString res(text);
+			Assert::IsTrue(expected == res.lower(std::execution::par, 4));
+			Assert::IsTrue(expected == res);
+			Assert::IsTrue(expected == pcs::CppString(text).lower(std::execution::seq));
+
+			pcs::CppWString wtext(L"ABC def");
+			Assert::IsTrue(pcs::CppWString(wtext).lower() == wtext.lower(std::execution::par));
+		}
+
 		TEST_METHOD(lstrip)
 		{
 			using namespace pcs;
@@ -3351,6 +3780,49 @@ namespace cppstringstests
 			Assert::AreEqual(L"", wres[2].c_str());
 		}
 
+		TEST_METHOD(partition_ch)
+		{
+			pcs::CppString s("key=value=x");
+			std::vector<pcs::CppString> res{ s.partition('=') };
+			Assert::AreEqual(std::size_t(3), res.size());
+			Assert::AreEqual("key", res[0].c_str());
+			Assert::AreEqual("=", res[1].c_str());
+			Assert::AreEqual("value=x", res[2].c_str());
+
+			res = s.partition('#');
+			Assert::AreEqual("key=value=x", res[0].c_str());
+			Assert::AreEqual("", res[1].c_str());
+			Assert::AreEqual("", res[2].c_str());
+
+			std::vector<pcs::CppWString> wres{ pcs::CppWString(L"a=").partition(L'=') };
+			Assert::AreEqual(L"a", wres[0].c_str());
+			Assert::AreEqual(L"=", wres[1].c_str());
+			Assert::AreEqual(L"", wres[2].c_str());
+		}
+
+		TEST_METHOD(partition_interned)
+		{
+			pcs::CppString s("abcd#123efg");
+			std::vector<pcs::CppInterned> res{ s.partition_interned("#123") };
+			Assert::AreEqual("abcd", res[0].c_str());
+			Assert::AreEqual("#123", res[1].c_str());
+			Assert::AreEqual("efg", res[2].c_str());
+			Assert::IsTrue(res[0] == pcs::intern("abcd"));
+			Assert::IsTrue(res[2] == pcs::intern("efg"));
+
+			res = s.partition_interned("XYZ");
+			Assert::AreEqual("abcd#123efg", res[0].c_str());
+			Assert::IsTrue(res[1].empty());
+			Assert::IsTrue(res[2].empty());
+
+			pcs::CppWString ws(L"abcd#123efg");
+			std::vector<pcs::CppWInterned> wres{ ws.partition_interned(L"#123") };
+			Assert::AreEqual(L"abcd", wres[0].c_str());
+			Assert::AreEqual(L"#123", wres[1].c_str());
+			Assert::AreEqual(L"efg", wres[2].c_str());
+			Assert::IsTrue(wres[1] == pcs::intern(L"#123"));
+		}
+
 		TEST_METHOD(removeprefix)
 		{
 			using namespace pcs;
@@ -3406,6 +3878,12 @@ namespace cppstringstests
 			Assert::AreEqual("AAbbAAAA", s.replace("a", "AA", 3).c_str());
 			Assert::AreEqual("aBBaa", s.replace("b", "B", 5).c_str());
 
+			// occurrences do not overlap, as with Python str.replace()
+			Assert::AreEqual("bba", pcs::CppString("aaaaa").replace("aa", "b").c_str());
+			Assert::AreEqual("baaa", pcs::CppString("aaaaa").replace("aa", "b", 1).c_str());
+			Assert::AreEqual("xbbx", pcs::CppString("ababbaba").replace("aba", "x").c_str());
+			Assert::AreEqual(L"bba", pcs::CppWString(L"aaaaa").replace(L"aa", L"b").c_str());
+
 			pcs::CppWString ws(L"abbaa");
 			Assert::AreEqual(L"abbaa", ws.replace(L"e", L"fff").c_str());
 			Assert::AreEqual(L"AAbbAAAA", ws.replace(L"a", L"AA").c_str());
@@ -3422,6 +3900,85 @@ namespace cppstringstests
 			Assert::AreEqual(L"abbaa", ws.replace(L"e", L"fff", 2).c_str());
 			Assert::AreEqual(L"AAbbAAAA", ws.replace(L"a", L"AA", 3).c_str());
 			Assert::AreEqual(L"aBBaa", ws.replace(L"b", L"B", 5).c_str());
+
+			s = "aaaaa";
+			Assert::AreEqual("bba", s.replace("aa", "b").c_str());
+			Assert::AreEqual("baaa", s.replace("aa", "b", 1).c_str());
+			Assert::AreEqual("aaaa", s.replace("aaa", "aa").c_str());
+		}
+
+		TEST_METHOD(replace_into)
+		{
+			pcs::CppString s("abcabcab");
+			std::array<char, 32> buf{};
+			std::size_t n{ s.replace_into(std::span(buf), "ab", "xyz") };
+			Assert::AreEqual("xyzcxyzcxyz", pcs::CppString(buf.data(), n).c_str());
+			n = s.replace_into(std::span(buf), "ab", "", 2);
+			Assert::AreEqual("ccab", pcs::CppString(buf.data(), n).c_str());
+			n = s.replace_into(std::span(buf), "", "x");
+			Assert::AreEqual("abcabcab", pcs::CppString(buf.data(), n).c_str());
+
+			std::array<char, 3> small{};
+			Assert::AreEqual(std::size_t(11), s.replace_into(std::span(small), "ab", "xyz"));
+			Assert::AreEqual(pcs::CppString("xyz").c_str(), pcs::CppString(small.data(), small.size()).c_str());
+
+			pcs::CppWString ws(L"aaaaa");
+			pcs::CppWString wres;
+			ws.replace_into(std::back_inserter(wres), L"aa", L"b");
+			Assert::AreEqual(L"bba", wres.c_str());
+		}
+
+		TEST_METHOD(replace_ch)
+		{
+			pcs::CppString s("a,b,c,d");
+			Assert::AreEqual("a;b;c;d", s.replace(',', ';').c_str());
+			Assert::AreEqual("a;b;c,d", s.replace(',', ';', 2).c_str());
+			Assert::AreEqual("a,b,c,d", s.replace(',', ';', 0).c_str());
+			Assert::AreEqual("a,b,c,d", s.replace('z', ';').c_str());
+			Assert::AreEqual(s.replace(pcs::CppString(","), pcs::CppString(";")).c_str(), s.replace(',', ';').c_str());
+
+			pcs::CppWString ws(L"a,b,c");
+			Assert::AreEqual(L"a;b,c", ws.replace(L',', L';', 1).c_str());
+		}
+
+		TEST_METHOD(replace_many)
+		{
+			pcs::CppString s("a < b && c > d");
+			Assert::AreEqual("a &lt; b &amp;&amp; c &gt; d", s.replace_many({ {"&", "&amp;"}, {"<", "&lt;"}, {">", "&gt;"} }).c_str());
+			Assert::AreEqual("a < b && c > d", s.replace_many({}).c_str());
+			Assert::AreEqual("", pcs::CppString().replace_many({ {"a", "b"} }).c_str());
+
+			// leftmost-longest, no rescan of replacements
+			Assert::AreEqual("X-Y", pcs::CppString("abc-ab").replace_many({ {"a", "Z"}, {"abc", "X"}, {"ab", "Y"} }).c_str());
+			Assert::AreEqual("ba", pcs::CppString("ab").replace_many({ {"a", "b"}, {"b", "a"} }).c_str());
+			Assert::AreEqual("xa", pcs::CppString("aaa").replace_many({ {"aa", "x"}, {"aaaa", "y"} }).c_str());
+			Assert::AreEqual("abc", pcs::CppString("abc").replace_many({ {"", "x"}, {"abcd", "y"} }).c_str());
+			Assert::AreEqual("2", pcs::CppString("a").replace_many({ {"a", "1"}, {"a", "2"} }).c_str());
+
+			pcs::CppWString ws(L"**bold** and _it_");
+			Assert::AreEqual(L"<b>bold<b> and <i>it<i>", ws.replace_many({ {L"**", L"<b>"}, {L"_", L"<i>"} }).c_str());
+		}
+
+		TEST_METHOD(replace_parallel)
+		{
+			// 4 chunks of 1 << 16 chars, occurrences straddling the chunks bounds
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString(index % 6, 'a') + "b";
+			for (const std::size_t bound : { std::size_t(1) << 16, std::size_t(2) << 16, std::size_t(3) << 16 })
+				text[bound] = text[bound - 1] = 'a';
+
+			for (const pcs::CppString old : { "a", "aa", "aaa", "ab", "bab", "x" }) {
+				for (const pcs::CppString new_ : { "", "Z", "<--->" }) {
+					Assert::IsTrue(text.replace(old, new_) == text.replace(std::execution::par, old, new_, -1, 4));
+					Assert::IsTrue(text.replace(old, new_, 5000) == text.replace(std::execution::par_unseq, old, new_, 5000, 3));
+				}
+			}
+
+			Assert::AreEqual("XXa", pcs::CppString("aaaaa").replace(std::execution::par, "aa", "X").c_str());
+			Assert::AreEqual("Xaaa", pcs::CppString("aaaaa").replace(std::execution::par, "aa", "X", 1).c_str());
+			Assert::AreEqual("abc", pcs::CppString("abc").replace(std::execution::par, "", "X").c_str());
+			Assert::AreEqual(L"a--b--", pcs::CppWString(L"a-b-").replace(std::execution::seq, L"-", L"--").c_str());
 		}
 
 		TEST_METHOD(rfind)
@@ -3535,6 +4092,20 @@ namespace cppstringstests
 			Assert::AreEqual(size_t(13), wtest.rfind(L".", 13));
 		}
 
+		TEST_METHOD(rfind_any)
+		{
+			const pcs::CharSet seps("/?#");
+			pcs::CppString s("http://host/path?q#f");
+			Assert::AreEqual(std::size_t(18), s.rfind_any(seps));
+			Assert::AreEqual(std::size_t(16), s.rfind_any(seps, 0, 17));
+			Assert::AreEqual(std::size_t(11), s.rfind_any(seps, 7, 15));
+			Assert::AreEqual(pcs::CppString::npos, s.rfind_any(seps, 12, 15));
+			Assert::AreEqual(pcs::CppString::npos, s.rfind_any(pcs::CharSet("xyz")));
+
+			pcs::CppWString ws(L"a b\tc");
+			Assert::AreEqual(std::size_t(3), ws.rfind_any(pcs::WCharSet::whitespaces()));
+		}
+
 		TEST_METHOD(rfind_n)
 		{
 			size_t found_pos;
@@ -3904,25 +4475,40 @@ namespace cppstringstests
 			Assert::AreEqual("abc", s.rjust(1).c_str());
 			Assert::AreEqual("abc", s.rjust(2).c_str());
 			Assert::AreEqual("abc", s.rjust(3).c_str());
-			Assert::AreEqual("abc ", s.rjust(4).c_str());
-			Assert::AreEqual("abc  ", s.rjust(5).c_str());
+			Assert::AreEqual(" abc", s.rjust(4).c_str());
+			Assert::AreEqual("  abc", s.rjust(5).c_str());
 			Assert::AreEqual("abc", s.rjust(1).c_str());
 			Assert::AreEqual("abc", s.rjust(2).c_str());
 			Assert::AreEqual("abc", s.rjust(3).c_str());
-			Assert::AreEqual("abc.", s.rjust(4, '.').c_str());
-			Assert::AreEqual("abc..", s.rjust(5, '.').c_str());
+			Assert::AreEqual(".abc", s.rjust(4, '.').c_str());
+			Assert::AreEqual("..abc", s.rjust(5, '.').c_str());
 
 			pcs::CppWString ws(L"abc");
 			Assert::AreEqual(L"abc", ws.rjust(1).c_str());
 			Assert::AreEqual(L"abc", ws.rjust(2).c_str());
 			Assert::AreEqual(L"abc", ws.rjust(3).c_str());
-			Assert::AreEqual(L"abc ", ws.rjust(4).c_str());
-			Assert::AreEqual(L"abc  ", ws.rjust(5).c_str());
+			Assert::AreEqual(L" abc", ws.rjust(4).c_str());
+			Assert::AreEqual(L"  abc", ws.rjust(5).c_str());
 			Assert::AreEqual(L"abc", ws.rjust(1).c_str());
 			Assert::AreEqual(L"abc", ws.rjust(2).c_str());
 			Assert::AreEqual(L"abc", ws.rjust(3).c_str());
-			Assert::AreEqual(L"abc.", ws.rjust(4, '.').c_str());
-			Assert::AreEqual(L"abc..", ws.rjust(5, '.').c_str());
+			Assert::AreEqual(L".abc", ws.rjust(4, '.').c_str());
+			Assert::AreEqual(L"..abc", ws.rjust(5, '.').c_str());
+		}
+
+		TEST_METHOD(rjust_into)
+		{
+			pcs::CppString s("abc");
+			std::array<char, 8> buf{};
+			Assert::AreEqual(s.rjust(6, '.').size(), s.rjust_into(std::span(buf), 6, '.'));
+			Assert::AreEqual(s.rjust(6, '.').c_str(), pcs::CppString(buf.data()).c_str());
+			Assert::AreEqual("...abc", pcs::CppString(buf.data()).c_str());
+			Assert::AreEqual(std::size_t(3), s.rjust_into(std::span(buf), 2));
+
+			pcs::CppWString ws(L"abc");
+			pcs::CppWString wres;
+			ws.rjust_into(std::back_inserter(wres), 5, L'#');
+			Assert::AreEqual(ws.rjust(5, L'#').c_str(), wres.c_str());
 		}
 
 		TEST_METHOD(rpartition)
@@ -4443,6 +5029,70 @@ namespace cppstringstests
 			Assert::AreEqual(L"", wres[8].c_str());
 		}
 
+		TEST_METHOD(rsplit_ch)
+		{
+			pcs::CppString s("a/b//c");
+			std::vector<pcs::CppString> res{ s.rsplit('/') };
+			Assert::AreEqual(std::size_t(4), res.size());
+			Assert::AreEqual("a", res[0].c_str());
+			Assert::AreEqual("b", res[1].c_str());
+			Assert::AreEqual("", res[2].c_str());
+			Assert::AreEqual("c", res[3].c_str());
+
+			res = s.rsplit('/', 1);
+			Assert::AreEqual(std::size_t(2), res.size());
+			Assert::AreEqual("a/b/", res[0].c_str());
+			Assert::AreEqual("c", res[1].c_str());
+
+			std::vector<pcs::CppWString> wres{ pcs::CppWString(L"a.b").rsplit(L'.') };
+			Assert::AreEqual(std::size_t(2), wres.size());
+			Assert::AreEqual(L"b", wres[1].c_str());
+		}
+
+		TEST_METHOD(rsplit_view)
+		{
+			const pcs::CppString path("http://host/a/bb/ccc");
+			std::vector<std::string_view> words;
+			for (const auto word : path.rsplit_view("/") | std::views::take(2))
+				words.push_back(word);
+			Assert::AreEqual(std::size_t(2), words.size());
+			Assert::IsTrue(words[0] == "ccc");
+			Assert::IsTrue(words[1] == "bb");
+
+			words.clear();
+			for (const auto word : path.rsplit_view("/", 2))
+				words.push_back(word);
+			Assert::AreEqual(std::size_t(3), words.size());
+			Assert::IsTrue(words[0] == "ccc");
+			Assert::IsTrue(words[1] == "bb");
+			Assert::IsTrue(words[2] == "http://host/a");
+
+			words.clear();
+			const pcs::CppString s(",a,,");
+			for (const auto word : s.rsplit_view(","))
+				words.push_back(word);
+			Assert::AreEqual(std::size_t(4), words.size());
+			Assert::IsTrue(words[0].empty());
+			Assert::IsTrue(words[1].empty());
+			Assert::IsTrue(words[2] == "a");
+			Assert::IsTrue(words[3].empty());
+
+			std::vector<pcs::CppString> res{ pcs::CppString("abc").rsplit(",", 3) };
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("abc", res[0].c_str());
+			res = pcs::CppString("").rsplit(",", 3);
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("", res[0].c_str());
+
+			const pcs::CppWString wpath(L"a::b::c");
+			std::vector<std::wstring_view> wwords;
+			for (const auto word : wpath.rsplit_view(L"::", 1))
+				wwords.push_back(word);
+			Assert::AreEqual(std::size_t(2), wwords.size());
+			Assert::IsTrue(wwords[0] == L"c");
+			Assert::IsTrue(wwords[1] == L"a::b");
+		}
+
 		TEST_METHOD(rstrip)
 		{
 			pcs::CppString s(" abcd efg   ");
@@ -4503,6 +5153,49 @@ namespace cppstringstests
 			Assert::AreEqual(L"", wsres.c_str());
 		}
 
+		TEST_METHOD(sort_key)
+		{
+			const auto before = [](const pcs::CppString& left, const pcs::CppString& right, const bool natural = false) {
+				return left.sort_key(natural) < right.sort_key(natural);
+			};
+
+			Assert::IsTrue(before("apple", "Banana"));
+			Assert::IsTrue(before("a", "A"));
+			Assert::IsTrue(before("A", "b"));
+			Assert::IsTrue(before("abc", "abcd"));
+			Assert::IsTrue(before(" z", "!a"));
+			Assert::IsTrue(before("!z", "0a"));
+			Assert::IsTrue(before("9", "a"));
+			Assert::IsTrue(before("z", "\xce\xb1"));
+			Assert::IsTrue(before("e", "\xc3\xa9"));
+			Assert::IsTrue(before("\xc3\xa9", "f"));
+			Assert::IsTrue(before("\xc3\xa9", "\xc3\x89"));
+			Assert::IsTrue(before("cote", "c\xc3\xb4te"));
+			Assert::IsTrue(before("\xc3\x85ngstr\xc3\xb6m", "Angus"));
+			Assert::IsTrue(before("\xce\xb1", "\xce\x92"));
+			Assert::IsTrue(before("\xd0\xb0", "\xd0\x91"));
+			Assert::AreEqual(pcs::CppString("\xc3\xa9").sort_key(), pcs::CppString("e\xcc\x81").sort_key());
+			Assert::IsTrue(pcs::CppString("abc").sort_key() == pcs::CppString("abc").sort_key());
+			Assert::IsTrue(pcs::CppString("").sort_key() < pcs::CppString(" ").sort_key());
+
+			Assert::IsTrue(before("file10", "file2"));
+			Assert::IsTrue(before("file2", "file10", true));
+			Assert::IsTrue(before("file2", "File10", true));
+			Assert::IsTrue(before("file2", "file02", true));
+			Assert::IsTrue(before("file02", "file3", true));
+			Assert::IsTrue(before("v1.9", "v1.10", true));
+			Assert::IsTrue(before("0", "00", true));
+			Assert::IsTrue(before("x9", "xa", true));
+			Assert::IsTrue(before("x123456789012345678901", "x123456789012345678902", true));
+			Assert::IsTrue(before("x99999999999999999999", "x100000000000000000000", true));
+
+			const pcs::CppWString ws(L"\u00c9t\u00e9");
+			Assert::IsTrue(pcs::CppWString(L"ete").sort_key() < ws.sort_key());
+			Assert::IsTrue(ws.sort_key() < pcs::CppWString(L"etf").sort_key());
+			Assert::IsTrue(pcs::CppWString(L"z").sort_key() < pcs::CppWString(L"\U0001F600").sort_key());
+			Assert::IsTrue(pcs::CppWString(L"img12").sort_key(true) < pcs::CppWString(L"IMG100").sort_key(true));
+		}
+
 		TEST_METHOD(split)
 		{
 			pcs::CppString s(" abcd efg   hij klmn  ");
@@ -4971,6 +5664,210 @@ namespace cppstringstests
 			Assert::AreEqual(L"", wres[8].c_str());
 		}
 
+		TEST_METHOD(split_any)
+		{
+			const pcs::CharSet seps(",;");
+			std::vector<pcs::CppString> res{ pcs::CppString("a,b;;c").split_any(seps) };
+			Assert::AreEqual(std::size_t(4), res.size());
+			Assert::AreEqual("a", res[0].c_str());
+			Assert::AreEqual("b", res[1].c_str());
+			Assert::AreEqual("", res[2].c_str());
+			Assert::AreEqual("c", res[3].c_str());
+
+			res = pcs::CppString("a,b;;c").split_any(seps, 1);
+			Assert::AreEqual(std::size_t(2), res.size());
+			Assert::AreEqual("b;;c", res[1].c_str());
+
+			res = pcs::CppString().split_any(seps);
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("", res[0].c_str());
+
+			std::vector<pcs::CppWString> wres{ pcs::CppWString(L"a b\tc").split_any(pcs::WCharSet::whitespaces()) };
+			Assert::AreEqual(std::size_t(3), wres.size());
+			Assert::AreEqual(L"c", wres[2].c_str());
+		}
+
+		TEST_METHOD(split_ch)
+		{
+			pcs::CppString s("1,,2,3,");
+			std::vector<pcs::CppString> res{ s.split(',') };
+			Assert::AreEqual(std::size_t(5), res.size());
+			Assert::AreEqual("1", res[0].c_str());
+			Assert::AreEqual("", res[1].c_str());
+			Assert::AreEqual("2", res[2].c_str());
+			Assert::AreEqual("3", res[3].c_str());
+			Assert::AreEqual("", res[4].c_str());
+
+			res = s.split(',', 2);
+			Assert::AreEqual(std::size_t(3), res.size());
+			Assert::AreEqual("1", res[0].c_str());
+			Assert::AreEqual("", res[1].c_str());
+			Assert::AreEqual("2,3,", res[2].c_str());
+
+			res = pcs::CppString("abc").split(',');
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("abc", res[0].c_str());
+
+			res = pcs::CppString().split(',');
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("", res[0].c_str());
+
+			std::vector<pcs::CppWString> wres{ pcs::CppWString(L"a b").split(L' ') };
+			Assert::AreEqual(std::size_t(2), wres.size());
+			Assert::AreEqual(L"a", wres[0].c_str());
+			Assert::AreEqual(L"b", wres[1].c_str());
+		}
+
+		TEST_METHOD(split_interned)
+		{
+			pcs::CppString s("key=abc;key=de;abc");
+			std::vector<pcs::CppString> words{ s.split(";") };
+			std::vector<pcs::CppInterned> res{ s.split_interned(";") };
+			Assert::AreEqual(words.size(), res.size());
+			for (std::size_t i = 0; i < words.size(); ++i)
+				Assert::AreEqual(words[i].c_str(), res[i].c_str());
+
+			res = s.split_interned("=");
+			Assert::AreEqual(std::size_t(3), res.size());
+			Assert::IsTrue(res[1] == pcs::intern("abc;key"));
+			res = s.split_interned(";", 1);
+			Assert::AreEqual(std::size_t(2), res.size());
+			Assert::IsTrue(res[1] == pcs::intern("key=de;abc"));
+
+			res = pcs::CppString().split_interned(",");
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::IsTrue(res[0].empty());
+			res = pcs::CppString("abc").split_interned("");
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::IsTrue(res[0] == pcs::intern("abc"));
+			res = pcs::CppString("a,,b,").split_interned(",");
+			Assert::AreEqual(std::size_t(4), res.size());
+			Assert::IsTrue(res[1].empty() && res[3].empty());
+
+			pcs::CppString t(" a  b a ");
+			res = t.split_interned();
+			words = t.split();
+			Assert::AreEqual(words.size(), res.size());
+			Assert::IsTrue(res[1] == res[4]);
+			Assert::IsTrue(res[0] == res[2]);
+			Assert::IsTrue(res[0].empty());
+
+			pcs::CppWString ws(L"x,y,x");
+			std::vector<pcs::CppWInterned> wres{ ws.split_interned(L",") };
+			Assert::AreEqual(std::size_t(3), wres.size());
+			Assert::IsTrue(wres[0] == wres[2]);
+			Assert::IsFalse(wres[0] == wres[1]);
+		}
+
+		TEST_METHOD(split_into)
+		{
+			pcs::SplitBuffer out;
+			pcs::CppString("a long first word,b,c").split_into(out, ",");
+			Assert::AreEqual(std::size_t(3), out.size());
+			Assert::AreEqual("a long first word", out[0].c_str());
+			const char* const first_data{ out[0].data() };
+			const std::size_t capacity{ out.capacity() };
+
+			pcs::CppString("x,y").split_into(out, ',');
+			Assert::AreEqual(std::size_t(2), out.size());
+			Assert::AreEqual("x", out[0].c_str());
+			Assert::AreEqual("y", out[1].c_str());
+			Assert::IsTrue(first_data == out[0].data());
+			Assert::AreEqual(capacity, out.capacity());
+
+			pcs::CppString("1<>2<>3<>4").split_into(out, "<>", 2);
+			Assert::AreEqual(std::size_t(3), out.size());
+			Assert::AreEqual("1", out[0].c_str());
+			Assert::AreEqual("2", out[1].c_str());
+			Assert::AreEqual("3<>4", out[2].c_str());
+
+			pcs::CppString("abc").split_into(out, ",");
+			Assert::AreEqual(std::size_t(1), out.size());
+			Assert::AreEqual("abc", out[0].c_str());
+			pcs::CppString().split_into(out, ',');
+			Assert::AreEqual(std::size_t(1), out.size());
+			Assert::AreEqual("", out[0].c_str());
+			Assert::AreEqual(capacity, out.capacity());
+			Assert::IsTrue(first_data == out[0].data());
+			Assert::AreEqual(std::size_t(1), std::size_t(std::distance(out.begin(), out.end())));
+
+			std::vector<pcs::CppString> words{ std::move(out).release() };
+			Assert::AreEqual(std::size_t(1), words.size());
+			Assert::IsTrue(out.empty());
+
+			pcs::WSplitBuffer wout;
+			pcs::CppWString(L"a::b::").split_into(wout, L"::");
+			Assert::AreEqual(std::size_t(3), wout.size());
+			Assert::AreEqual(L"b", wout[1].c_str());
+			Assert::AreEqual(L"", wout[2].c_str());
+		}
+
+		TEST_METHOD(split_parallel)
+		{
+			// 4 chunks of 1 << 16 chars, separators straddling the chunks bounds
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString(index % 7, 'a') + "<>";
+			for (const std::size_t bound : { std::size_t(1) << 16, std::size_t(2) << 16, std::size_t(3) << 16 }) {
+				text[bound - 1] = '<';
+				text[bound] = '>';
+			}
+
+			for (const pcs::CppString sep : { "<>", "a", "aa", "a<", "x" }) {
+				const std::vector<pcs::CppString> expected{ text.split(sep) };
+				const std::vector<pcs::CppString> res{ text.split(std::execution::par, sep, 4) };
+				Assert::IsTrue(expected == res);
+				const pcs::StringColumn column{ text.split_column(std::execution::par, sep, 4) };
+				Assert::AreEqual(expected.size(), column.size());
+				Assert::IsTrue(expected == column.to_vector());
+				Assert::IsTrue(expected == text.split(std::execution::seq, sep));
+				Assert::IsTrue(expected == text.split_column(std::execution::seq, sep).to_vector());
+			}
+
+			const std::vector<pcs::CppString> res{ pcs::CppString("1<>2<><>3").split(std::execution::par, "<>") };
+			Assert::AreEqual(std::size_t(4), res.size());
+			Assert::AreEqual("2", res[1].c_str());
+			Assert::AreEqual("", res[2].c_str());
+			Assert::AreEqual(std::size_t(1), pcs::CppString().split(std::execution::par, ",").size());
+			Assert::AreEqual(std::size_t(1), pcs::CppString("abc").split(std::execution::par, "").size());
+
+			const std::vector<pcs::CppWString> wres{ pcs::CppWString(L"x::y").split(std::execution::par_unseq, L"::", 2) };
+			Assert::AreEqual(std::size_t(2), wres.size());
+			Assert::AreEqual(L"y", wres[1].c_str());
+		}
+
+		TEST_METHOD(split_whitespace)
+		{
+			std::vector<pcs::CppString> res{ pcs::CppString("  a\tbb \n\r ccc\v\fd  ").split_whitespace() };
+			Assert::AreEqual(std::size_t(4), res.size());
+			Assert::AreEqual("a", res[0].c_str());
+			Assert::AreEqual("bb", res[1].c_str());
+			Assert::AreEqual("ccc", res[2].c_str());
+			Assert::AreEqual("d", res[3].c_str());
+
+			res = pcs::CppString(" a\tb  c ").split_whitespace(1);
+			Assert::AreEqual(std::size_t(2), res.size());
+			Assert::AreEqual("a", res[0].c_str());
+			Assert::AreEqual("b  c ", res[1].c_str());
+
+			res = pcs::CppString(" a b ").split_whitespace(0);
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("a b ", res[0].c_str());
+
+			res = pcs::CppString("a ").split_whitespace(1);
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("a", res[0].c_str());
+
+			Assert::AreEqual(std::size_t(0), pcs::CppString().split_whitespace().size());
+			Assert::AreEqual(std::size_t(0), pcs::CppString(" \t\n ").split_whitespace().size());
+			Assert::AreEqual(std::size_t(1), pcs::CppString("abc").split_whitespace().size());
+
+			std::vector<pcs::CppWString> wres{ pcs::CppWString(L"\u3000a\u00a0b\u2028").split_whitespace() };
+			Assert::AreEqual(std::size_t(2), wres.size());
+			Assert::AreEqual(L"a", wres[0].c_str());
+			Assert::AreEqual(L"b", wres[1].c_str());
+		}
+
 		TEST_METHOD(splitline)
 		{
 #pragma warning(push)
@@ -5154,6 +6051,69 @@ namespace cppstringstests
 
 		}
 
+		TEST_METHOD(splitlines_into)
+		{
+			pcs::SplitBuffer out;
+			pcs::CppString("first line\r\nsecond\rthird\n\nlast").splitlines_into(out);
+			Assert::AreEqual(std::size_t(5), out.size());
+			Assert::AreEqual("first line", out[0].c_str());
+			Assert::AreEqual("second", out[1].c_str());
+			Assert::AreEqual("third", out[2].c_str());
+			Assert::AreEqual("", out[3].c_str());
+			Assert::AreEqual("last", out[4].c_str());
+			const char* const first_data{ out[0].data() };
+
+			pcs::CppString("a\r\nb\f").splitlines_into(out, true);
+			Assert::AreEqual(std::size_t(2), out.size());
+			Assert::AreEqual("a\r\n", out[0].c_str());
+			Assert::AreEqual("b\f", out[1].c_str());
+			Assert::IsTrue(first_data == out[0].data());
+
+			pcs::CppString().splitlines_into(out);
+			Assert::AreEqual(std::size_t(0), out.size());
+			Assert::AreEqual(std::size_t(5), out.capacity());
+			Assert::IsTrue(first_data == out[0].data());
+
+			pcs::WSplitBuffer wout;
+			pcs::CppWString(L"x\ny").splitlines_into(wout);
+			Assert::AreEqual(std::size_t(2), wout.size());
+			Assert::AreEqual(L"y", wout[1].c_str());
+		}
+
+		TEST_METHOD(splitlines_parallel)
+		{
+			// 4 chunks of 1 << 16 chars, "\r\n" pairs straddling the chunks bounds
+			pcs::CppString text;
+			const char* const eols[]{ "\n", "\r\n", "\r", "\f", "\x1e", "\r\n\n" };
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString(index % 11, 'z') + eols[index % 6];
+			for (const std::size_t bound : { std::size_t(1) << 16, std::size_t(2) << 16 }) {
+				text[bound - 1] = '\r';
+				text[bound] = '\n';
+			}
+			text[(std::size_t(3) << 16) - 1] = '\r';
+			text += "last";
+
+			for (const bool keep_end : { false, true }) {
+				const std::vector<pcs::CppString> expected{ text.splitlines(keep_end) };
+				Assert::IsTrue(expected == text.splitlines(std::execution::par, keep_end, 4));
+				Assert::IsTrue(expected == text.splitlines_column(std::execution::par, keep_end, 4).to_vector());
+				Assert::IsTrue(expected == text.splitlines(std::execution::seq, keep_end));
+				Assert::IsTrue(expected == text.splitlines_column(std::execution::seq, keep_end).to_vector());
+			}
+
+			const std::vector<pcs::CppString> res{ pcs::CppString("a\r\n\nb\r").splitlines(std::execution::par) };
+			Assert::AreEqual(std::size_t(3), res.size());
+			Assert::AreEqual("a", res[0].c_str());
+			Assert::AreEqual("", res[1].c_str());
+			Assert::AreEqual("b", res[2].c_str());
+			Assert::AreEqual(std::size_t(0), pcs::CppString().splitlines(std::execution::par).size());
+
+			const std::vector<pcs::CppWString> wres{ pcs::CppWString(L"x\ny\n").splitlines(std::execution::par_unseq, true) };
+			Assert::AreEqual(std::size_t(2), wres.size());
+			Assert::AreEqual(L"y\n", wres[1].c_str());
+		}
+
 		TEST_METHOD(startswith)
 		{
 			pcs::CppString text("Abcdef");
@@ -5424,6 +6384,62 @@ namespace cppstringstests
 			Assert::AreEqual(L"abcdefedcbaea", wtext.strip(L"ABc").c_str());
 		}
 
+		TEST_METHOD(strip_charset)
+		{
+			const pcs::CharSet punct(".,;:!?\"'");
+			pcs::CppString s("\"Hello, world!\"");
+			Assert::AreEqual("Hello, world", s.strip(punct).c_str());
+			Assert::AreEqual("Hello, world!\"", s.lstrip(punct).c_str());
+			Assert::AreEqual("\"Hello, world", s.rstrip(punct).c_str());
+			Assert::AreEqual("", pcs::CppString("?!").strip(punct).c_str());
+			Assert::AreEqual("", pcs::CppString("?!").lstrip(punct).c_str());
+			Assert::AreEqual("", pcs::CppString("?!").rstrip(punct).c_str());
+			Assert::AreEqual("a b", pcs::CppString(" \t\na b\r\n").strip(pcs::CharSet::whitespaces()).c_str());
+
+			pcs::CppWString ws(L"\u3000\u00a0abc\u2029");
+			Assert::AreEqual(L"abc", ws.strip(pcs::WCharSet::whitespaces()).c_str());
+
+			pcs::CppString ab("abxyba");
+			Assert::AreEqual("xy", ab.strip({ 'a', 'b' }).c_str());
+			Assert::AreEqual("xyba", ab.lstrip({ 'a', 'b' }).c_str());
+			Assert::AreEqual("abxy", ab.rstrip({ 'a', 'b' }).c_str());
+			Assert::AreEqual("xy", ab.delete_chars({ 'a', 'b' }).c_str());
+		}
+
+		TEST_METHOD(strip_into)
+		{
+			pcs::CppString s("  abc d  ");
+			std::array<char, 16> buf{};
+			Assert::AreEqual(std::size_t(5), s.strip_into(std::span(buf)));
+			Assert::AreEqual("abc d", pcs::CppString(buf.data()).c_str());
+
+			std::array<char, 16> buf2{};
+			Assert::AreEqual(std::size_t(3), pcs::CppString("xyabcyx").strip_into(std::span(buf2), "xy"));
+			Assert::AreEqual("abc", pcs::CppString(buf2.data()).c_str());
+			Assert::AreEqual(std::size_t(0), pcs::CppString("xyyx").strip_into(std::span(buf2), "xy"));
+			Assert::IsTrue(noexcept(s.strip_into(std::span(buf))));
+			Assert::IsFalse(noexcept(s.strip_into(std::span(buf), s)));
+
+			pcs::CppWString wres;
+			pcs::CppWString(L"--a-b--").strip_into(std::back_inserter(wres), L"-");
+			Assert::AreEqual(L"a-b", wres.c_str());
+		}
+
+		TEST_METHOD(strip_ch)
+		{
+			pcs::CppString s("--a-b--");
+			Assert::AreEqual("a-b", s.strip('-').c_str());
+			Assert::AreEqual("a-b--", s.lstrip('-').c_str());
+			Assert::AreEqual("--a-b", s.rstrip('-').c_str());
+			Assert::AreEqual("", pcs::CppString("---").strip('-').c_str());
+			Assert::AreEqual("", pcs::CppString("---").lstrip('-').c_str());
+			Assert::AreEqual("", pcs::CppString("---").rstrip('-').c_str());
+			Assert::AreEqual("abc", pcs::CppString("abc").strip('-').c_str());
+
+			pcs::CppWString ws(L"**x**");
+			Assert::AreEqual(L"x", ws.strip(L'*').c_str());
+		}
+
 		TEST_METHOD(substr)
 		{
 			pcs::CppString text("AbcDefGhi");
@@ -5532,6 +6548,31 @@ namespace cppstringstests
 			}
 		}
 
+		TEST_METHOD(swapcase_into)
+		{
+			std::array<char, 8> buf{};
+			Assert::AreEqual(std::size_t(5), pcs::CppString("aBc D").swapcase_into(std::span(buf)));
+			Assert::AreEqual(pcs::CppString("aBc D").swapcase().c_str(), pcs::CppString(buf.data()).c_str());
+
+			pcs::CppWString wres;
+			pcs::CppWString(L"aBc").swapcase_into(std::back_inserter(wres));
+			Assert::AreEqual(pcs::CppWString(L"aBc").swapcase().c_str(), wres.c_str());
+		}
+
+		TEST_METHOD(swapcase_parallel)
+		{
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString("Some Mixed-Case TEXT, line ") + char('a' + index % 26) + "\n";
+			Assert::IsTrue(text.swapcase() == text.swapcase(std::execution::par, 4));
+			Assert::IsTrue(text.swapcase() == text.swapcase(std::execution::par_unseq, 3));
+			Assert::IsTrue(text.swapcase() == text.swapcase(std::execution::seq));
+			Assert::AreEqual(std::size_t(0), pcs::CppString().swapcase(std::execution::par).size());
+
+			const pcs::CppWString wtext(L"ABC def");
+			Assert::IsTrue(wtext.swapcase() == wtext.swapcase(std::execution::par));
+		}
+
 		TEST_METHOD(title)
 		{
 			pcs::CppString text("to bE  TiTlEd - cheCKing,errors, in Case oF aNy fOUNd");
@@ -5546,6 +6587,66 @@ namespace cppstringstests
 
 		}
 
+		TEST_METHOD(to_float)
+		{
+			Assert::AreEqual(1.5, pcs::CppString("1.5").to_float());
+			Assert::AreEqual(-1025.0, pcs::CppString(" \t-1_025\n").to_float());
+			Assert::AreEqual(2.5e10, pcs::CppString("+2.5E1_0").to_float());
+			Assert::AreEqual(0.5, pcs::CppString(".5").to_float());
+			Assert::AreEqual(0.0, pcs::CppString("1e-400").to_float());
+			Assert::AreEqual(0.25f, pcs::CppString("0.25").to_float<float>());
+			Assert::IsTrue(std::isinf(pcs::CppString("-Infinity").to_float()));
+			Assert::IsTrue(pcs::CppString("-inf").to_float() < 0.0);
+			Assert::IsTrue(std::isnan(pcs::CppString("NaN").to_float()));
+			Assert::AreEqual(12.75, pcs::CppWString(L"\u3000 12.75").to_float());
+
+			for (const char* text : { "", " ", "1_", "_1", "1__0", "1_.5", "--1", "0x10", "nan(1)", "1e", "1.5x", "\xc2\xb2" })
+				Assert::ExpectException<pcs::CppString::ValueException>([text] { (void)pcs::CppString(text).to_float(); });
+			Assert::IsTrue(pcs::CppString("1e400").to_float() == HUGE_VAL);
+			Assert::IsTrue(pcs::CppString("-9e+012345678").to_float() == -HUGE_VAL);
+			Assert::IsTrue(pcs::CppString("1e40").to_float<float>() == HUGE_VALF);
+			Assert::ExpectException<pcs::CppWString::ValueException>([] { (void)pcs::CppWString(L"\u0661").to_float(); });
+		}
+
+		TEST_METHOD(to_int)
+		{
+			Assert::AreEqual(42, pcs::CppString("42").to_int());
+			Assert::AreEqual(-42, pcs::CppString("  -42\r\n").to_int());
+			Assert::AreEqual(1000000, pcs::CppString("+1_000_000").to_int());
+			Assert::AreEqual(255, pcs::CppString("ff").to_int(16));
+			Assert::AreEqual(255, pcs::CppString("0x_FF").to_int(16));
+			Assert::AreEqual(0xb1, pcs::CppString("0b1").to_int(16));
+			Assert::AreEqual(35 * 36 + 35, pcs::CppString("zZ").to_int(36));
+			Assert::AreEqual(255, pcs::CppString("0xff").to_int(0));
+			Assert::AreEqual(15, pcs::CppString("0o17").to_int(0));
+			Assert::AreEqual(-5, pcs::CppString("-0b101").to_int(0));
+			Assert::AreEqual(0, pcs::CppString("00").to_int(0));
+			Assert::AreEqual(10, pcs::CppString("010").to_int());
+			Assert::AreEqual(77, pcs::CppWString(L"\u2003 77 ").to_int());
+
+			// fields of 8 and 16 decimal digits
+			Assert::AreEqual(12345678, pcs::CppString("12345678").to_int());
+			Assert::AreEqual(1234, pcs::CppString("00001234").to_int());
+			Assert::AreEqual(-1234567890123456LL, pcs::CppString("-1234567890123456").to_int<long long>());
+			Assert::AreEqual(9999999999999999ULL, pcs::CppString("9999999999999999").to_int<unsigned long long>());
+
+			// limits of types
+			Assert::AreEqual(-2147483647 - 1, pcs::CppString("-2147483648").to_int());
+			Assert::AreEqual(std::int8_t(-128), pcs::CppString("-128").to_int<std::int8_t>());
+			Assert::AreEqual(std::uint8_t(255), pcs::CppString("255").to_int<std::uint8_t>());
+			Assert::AreEqual(0u, pcs::CppString("-0").to_int<unsigned>());
+
+			for (const char* text : { "", " ", "- 5", "+-5", "1__0", "_1", "1_", "1.0", "1234a678", "12345678x" })
+				Assert::ExpectException<pcs::CppString::ValueException>([text] { (void)pcs::CppString(text).to_int(); });
+			Assert::ExpectException<pcs::CppString::ValueException>([] { (void)pcs::CppString("010").to_int(0); });
+			Assert::ExpectException<pcs::CppString::ValueException>([] { (void)pcs::CppString("0x").to_int(16); });
+			Assert::ExpectException<pcs::CppString::ValueException>([] { (void)pcs::CppString("12").to_int(1); });
+			Assert::ExpectException<std::out_of_range>([] { (void)pcs::CppString("2147483648").to_int(); });
+			Assert::ExpectException<std::out_of_range>([] { (void)pcs::CppString("1234567890123456").to_int(); });
+			Assert::ExpectException<std::out_of_range>([] { (void)pcs::CppString("-1").to_int<unsigned>(); });
+			Assert::ExpectException<std::out_of_range>([] { (void)pcs::CppString("-129").to_int<std::int8_t>(); });
+		}
+
 		TEST_METHOD(translate)
 		{
 			pcs::CppString::TransTable trans_table("oizeaslbgOIZEASLG", "012345789012345789");
@@ -5559,6 +6660,55 @@ namespace cppstringstests
 			Assert::AreEqual(wexpected.c_str(), wtext.translate(wtrans_table).c_str());
 		}
 
+		TEST_METHOD(translate_into)
+		{
+			pcs::CppString::TransTable trans_table("oizeaslbgOIZEASLG", "012345789012345789");
+			pcs::CppString text("This is a big 'Oiseau' that can be seen in 'Le Zoo'");
+			std::array<char, 64> buf{};
+			const std::size_t n{ text.translate_into(std::span(buf), trans_table) };
+			Assert::AreEqual("Th15 15 4 819 '01534u' th4t c4n 83 533n 1n '73 200'", pcs::CppString(buf.data(), n).c_str());
+
+			pcs::CppWString::TransTable wtrans_table(L"ab", L"xy");
+			pcs::CppWString wres;
+			pcs::CppWString(L"abc").translate_into(std::back_inserter(wres), wtrans_table);
+			Assert::AreEqual(L"xyc", wres.c_str());
+		}
+
+		TEST_METHOD(translate_parallel)
+		{
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString("Some Mixed-Case TEXT, line ") + char('a' + index % 26) + "\n";
+			pcs::CppString::TransTable same_size_table("aeiouT", "AEIOU7");
+			Assert::IsTrue(text.translate(same_size_table) == text.translate(std::execution::par, same_size_table, 4));
+
+			pcs::CppString::TransTable table("aeiou", { "", "E", "<i>", "", "uuu" });
+			Assert::IsTrue(text.translate(table) == text.translate(std::execution::par, table, 4));
+			Assert::IsTrue(text.translate(table) == text.translate(std::execution::par_unseq, table, 3));
+			Assert::IsTrue(text.translate(table) == text.translate(std::execution::seq, table));
+
+			pcs::CppWString::TransTable wtable(L"a\u00e9", { L"4", L"e" });
+			Assert::AreEqual(L"4bce", pcs::CppWString(L"abc\u00e9").translate(std::execution::par, wtable).c_str());
+		}
+
+		TEST_METHOD(try_to_float)
+		{
+			Assert::AreEqual(-0.5, *pcs::CppString("-0.5").try_to_float());
+			Assert::IsTrue(pcs::CppString("x").try_to_float().error() == std::errc::invalid_argument);
+			Assert::IsTrue(*pcs::CppString("1e999").try_to_float() == HUGE_VAL);
+			Assert::IsTrue(*pcs::CppString("-1_000e1_000").try_to_float() == -HUGE_VAL);
+			Assert::AreEqual(3.0f, *pcs::CppWString(L"3").try_to_float<float>());
+		}
+
+		TEST_METHOD(try_to_int)
+		{
+			Assert::AreEqual(-7, *pcs::CppString(" -7 ").try_to_int());
+			Assert::AreEqual(std::int64_t(0x7fffffffffffffff), *pcs::CppString("0x7fff_ffff_ffff_ffff").try_to_int<std::int64_t>(0));
+			Assert::IsTrue(pcs::CppString("seven").try_to_int().error() == std::errc::invalid_argument);
+			Assert::IsTrue(pcs::CppString("300").try_to_int<std::uint8_t>().error() == std::errc::result_out_of_range);
+			Assert::IsTrue(!pcs::CppWString(L"\u0667").try_to_int().has_value());
+		}
+
 		TEST_METHOD(upper)
 		{
 			for (int c = 0; c <= 255; ++c) {
@@ -5609,6 +6759,34 @@ namespace cppstringstests
 
 		}
 
+		TEST_METHOD(upper_into)
+		{
+			const pcs::CppString s("AbC dE");
+			std::array<char, 8> buf{};
+			Assert::AreEqual(std::size_t(6), s.upper_into(std::span(buf)));
+			Assert::AreEqual("ABC DE", pcs::CppString(buf.data()).c_str());
+
+			pcs::CppWString wres;
+			pcs::CppWString(L"xYz").upper_into(std::back_inserter(wres));
+			Assert::AreEqual(L"XYZ", wres.c_str());
+		}
+
+		TEST_METHOD(upper_parallel)
+		{
+			pcs::CppString text;
+			for (std::size_t index = 0; text.size() < 4 * pcs::PARALLEL_MIN_CHARS; ++index)
+				text += pcs::CppString("Some Mixed-Case TEXT, line ") + char('a' + index % 26) + "\n";
+			pcs::CppString expected(text);
+			expected.upper();
+			pcs::CppString res(text);
+			Assert::IsTrue(expected == res.upper(std::execution::par, 4));
+			Assert::IsTrue(expected == res);
+			Assert::IsTrue(expected == pcs::CppString(text).upper(std::execution::seq));
+
+			pcs::CppWString wtext(L"ABC def");
+			Assert::IsTrue(pcs::CppWString(wtext).upper() == wtext.upper(std::execution::par));
+		}
+
 		TEST_METHOD(zfill)
 		{
 			pcs::CppString s("1.23");
@@ -5691,5 +6869,806 @@ namespace cppstringstests
 			Assert::AreEqual(L"00*1.23", ws.zfill(7).c_str());
 		}
 
+		TEST_METHOD(zfill_into)
+		{
+			std::array<char, 8> buf{};
+			Assert::AreEqual(std::size_t(5), pcs::CppString("-42").zfill_into(std::span(buf), 5));
+			Assert::AreEqual("-0042", pcs::CppString(buf.data()).c_str());
+
+			pcs::CppString res;
+			pcs::CppString("42").zfill_into(std::back_inserter(res), 4);
+			Assert::AreEqual("0042", res.c_str());
+
+			pcs::CppWString wres;
+			pcs::CppWString(L"+abc").zfill_into(std::back_inserter(wres), 3);
+			Assert::AreEqual(L"+abc", wres.c_str());
+		}
+
+	};
+
+	//=====   PART 6   ============================================
+	TEST_CLASS(cppstringstests_PART_6)
+	{
+	public:
+
+		TEST_METHOD(intern)
+		{
+			using namespace pcs;
+			CppInterned a1{ pcs::intern("abcd") };
+			CppInterned a2{ pcs::intern(std::string_view("abcd")) };
+			CppInterned a3{ pcs::intern("xabcdx"_cs.substr(1, 4)) };
+			CppInterned b{ pcs::intern("abce") };
+			Assert::IsTrue(a1 == a2);
+			Assert::IsTrue(a1 == a3);
+			Assert::IsFalse(a1 == b);
+			Assert::AreEqual(a1.c_str(), a2.c_str());
+			Assert::AreEqual("abcd", a1.c_str());
+			Assert::AreEqual(std::size_t(4), a1.size());
+			Assert::IsTrue(a1 == std::string_view("abcd"));
+			Assert::AreEqual("abcd", a1.str().c_str());
+			Assert::AreEqual(std::hash<CppInterned>{}(a1), std::hash<CppInterned>{}(a3));
+
+			CppInterned e1{ pcs::intern("") };
+			CppInterned e2{ pcs::intern(static_cast<const char*>(nullptr)) };
+			Assert::IsTrue(e1 == e2);
+			Assert::IsTrue(e1 == CppInterned());
+			Assert::IsTrue(e1.empty());
+			Assert::AreEqual("", e1.c_str());
+
+			CppWInterned w1{ pcs::intern(L"abcd") };
+			CppWInterned w2{ pcs::intern(L"abcd"_cs) };
+			Assert::IsTrue(w1 == w2);
+			Assert::AreEqual(L"abcd", w1.c_str());
+		}
+
+		TEST_METHOD(intern_pool)
+		{
+			pcs::InternPoolT<char> pool(4);
+			Assert::AreEqual(std::size_t(0), pool.size());
+
+			std::vector<pcs::CppInterned> handles;
+			for (int i = 0; i < 1000; ++i)
+				handles.push_back(pool.intern(std::to_string(i % 100)));
+			Assert::AreEqual(std::size_t(100), pool.size());
+			Assert::AreEqual(std::size_t(128), pool.buckets_count());
+			for (int i = 0; i < 1000; ++i) {
+				Assert::IsTrue(handles[i] == handles[i % 100]);
+				Assert::AreEqual(std::to_string(i % 100).c_str(), handles[i].c_str());
+			}
+
+			const std::string big(100000, 'x');
+			pcs::CppInterned h{ pool.intern(big) };
+			Assert::IsTrue(h == pool.intern(big));
+			Assert::AreEqual(std::size_t(101), pool.size());
+			Assert::IsTrue(pool.memory_usage() >= big.size());
+
+			pcs::InternPoolT<char> other_pool;
+			Assert::IsFalse(other_pool.intern("0") == pool.intern("0"));
+		}
+
+		TEST_METHOD(intern_threads)
+		{
+			pcs::InternPoolT<char> pool(2);
+			std::vector<std::vector<pcs::CppInterned>> handles(4);
+			std::vector<std::thread> threads;
+			for (int t = 0; t < 4; ++t)
+				threads.emplace_back([&pool, &handles, t] {
+					for (int i = 0; i < 2000; ++i)
+						handles[t].push_back(pool.intern(std::to_string(i)));
+				});
+			for (auto& th : threads)
+				th.join();
+
+			Assert::AreEqual(std::size_t(2000), pool.size());
+			for (int t = 1; t < 4; ++t)
+				for (int i = 0; i < 2000; ++i)
+					Assert::IsTrue(handles[0][i] == handles[t][i]);
+		}
+
+	};
+
+	//=====   PART 7   ============================================
+	TEST_CLASS(cppstringstests_PART_7)
+	{
+	public:
+
+		TEST_METHOD(rope_constructors)
+		{
+			pcs::CppRope r0;
+			Assert::IsTrue(r0.empty());
+			Assert::AreEqual(std::size_t(0), r0.size());
+			Assert::AreEqual("", r0.str().c_str());
+
+			pcs::CppRope r1("abc");
+			pcs::CppRope r2(pcs::CppString("abc"));
+			pcs::CppRope r3(std::string_view("abc"));
+			Assert::AreEqual("abc", r1.str().c_str());
+			Assert::AreEqual("abc", r2.str().c_str());
+			Assert::AreEqual("abc", r3.str().c_str());
+			Assert::AreEqual(std::size_t(0), r1.depth());
+
+			pcs::CppWRope wr(L"abc");
+			Assert::AreEqual(L"abc", wr.str().c_str());
+		}
+
+		TEST_METHOD(rope_concat)
+		{
+			pcs::CppRope r("abc");
+			r += pcs::CppRope("def");
+			r += 'g';
+			Assert::AreEqual("abcdefg", r.str().c_str());
+			Assert::AreEqual("xyzabcdefg", (pcs::CppRope("xyz") + r).str().c_str());
+			Assert::AreEqual("abcdefgabcdefgabcdefg", (r * 3).str().c_str());
+			Assert::IsTrue((r * 0).empty());
+
+			pcs::CppRope big;
+			std::string ref;
+			for (int i = 0; i < 10000; ++i) {
+				const std::string piece(std::size_t(1 + i % 700), char('a' + i % 26));
+				big += pcs::CppRope(pcs::CppString(piece));
+				ref += piece;
+			}
+			Assert::AreEqual(ref.size(), big.size());
+			Assert::IsTrue(ref == big.str());
+			Assert::IsTrue(big.depth() < 32);
+		}
+
+		TEST_METHOD(rope_indexing)
+		{
+			pcs::CppRope r;
+			std::string ref;
+			for (int i = 0; i < 1000; ++i) {
+				const std::string piece(std::size_t(1 + i % 900), char('a' + i % 26));
+				r = (i % 2) ? r + pcs::CppRope(pcs::CppString(piece)) : pcs::CppRope(pcs::CppString(piece)) + r;
+				ref = (i % 2) ? ref + piece : piece + ref;
+			}
+			for (std::size_t i = 0; i < ref.size(); i += 97)
+				Assert::AreEqual(ref[i], r[i]);
+		}
+
+		TEST_METHOD(rope_substr)
+		{
+			pcs::CppRope r{ pcs::CppRope("abcdef") + pcs::CppRope(pcs::CppString(600, 'x')) + pcs::CppRope("ghij") };
+			const std::string ref{ r.str() };
+			Assert::AreEqual("cdef", r.substr(2, 4).str().c_str());
+			Assert::AreEqual("efxx", r.substr(4, 4).str().c_str());
+			Assert::AreEqual("xghij", r.substr(605).str().c_str());
+			Assert::AreEqual("", r.substr(610).str().c_str());
+			Assert::AreEqual("", r.substr(1000).str().c_str());
+			for (std::size_t i = 0; i < ref.size(); i += 13)
+				for (std::size_t n = 0; n < 700; n += 61)
+					Assert::IsTrue(ref.substr(i, n) == r.substr(i, n).str());
+
+			std::string big_ref(100000, 'a');
+			for (std::size_t i = 0; i < big_ref.size(); ++i)
+				big_ref[i] = char('a' + i % 26);
+			const pcs::CppRope big{ pcs::CppString(big_ref) };
+			const pcs::CppRope middle{ big.substr(1000, 50000) };
+			const pcs::CppRope inner{ middle.substr(10, 20) + middle.substr(40000, 5) };
+			Assert::AreEqual(std::size_t(50000), middle.size());
+			Assert::IsTrue(big_ref.substr(1000, 50000) == middle.str());
+			Assert::IsTrue(big_ref.substr(1010, 20) + big_ref.substr(41000, 5) == inner.str());
+			Assert::AreEqual(big_ref[41002], inner[22]);
+		}
+
+		TEST_METHOD(rope_find)
+		{
+			pcs::CppRope r{ pcs::CppRope(pcs::CppString(600, 'a')) + pcs::CppRope("bc") + pcs::CppRope(pcs::CppString(600, 'd')) + pcs::CppRope("abcd") };
+			Assert::AreEqual(std::size_t(599), r.find("abc"));
+			Assert::AreEqual(std::size_t(1202), r.find("abc", 600));
+			Assert::AreEqual(std::size_t(600), r.find("bcd"));
+			Assert::AreEqual(pcs::CppRope::npos, r.find("xyz"));
+			Assert::AreEqual(std::size_t(7), r.find("", 7));
+			Assert::IsTrue(r.contains("cddd"));
+			Assert::IsFalse(r.contains("ad"));
+
+			pcs::CppWRope wr{ pcs::CppWRope(L"ab") + pcs::CppWRope(pcs::CppWString(600, L'c')) };
+			Assert::AreEqual(std::size_t(1), wr.find(L"bc"));
+		}
+
+		TEST_METHOD(rope_count)
+		{
+			pcs::CppRope r{ pcs::CppRope(pcs::CppString(600, 'a')) + pcs::CppRope(pcs::CppString(601, 'a')) };
+			Assert::AreEqual(std::size_t(1201), r.count("a"));
+			Assert::AreEqual(std::size_t(600), r.count("aa"));
+			Assert::AreEqual(std::size_t(400), r.count("aaa"));
+			Assert::AreEqual(std::size_t(0), r.count("b"));
+			Assert::AreEqual(std::size_t(1202), r.count(""));
+		}
+
+		TEST_METHOD(rope_split)
+		{
+			pcs::CppRope r{ pcs::CppRope(pcs::CppString(600, 'a')) + pcs::CppRope("<") + pcs::CppRope(pcs::CppString(600, '>')) + pcs::CppRope("b<>c") };
+			std::vector<pcs::CppString> res{ r.split("<>") };
+			Assert::AreEqual(std::size_t(3), res.size());
+			Assert::AreEqual(pcs::CppString(600, 'a').c_str(), res[0].c_str());
+			Assert::AreEqual((pcs::CppString(599, '>') + "b").c_str(), res[1].c_str());
+			Assert::AreEqual("c", res[2].c_str());
+
+			res = r.split("<>", 1);
+			Assert::AreEqual(std::size_t(2), res.size());
+			Assert::AreEqual((pcs::CppString(599, '>') + "b<>c").c_str(), res[1].c_str());
+
+			res = pcs::CppRope("a,b,,c").split(",");
+			Assert::AreEqual(std::size_t(4), res.size());
+			Assert::AreEqual("", res[2].c_str());
+
+			res = pcs::CppRope("abc").split(",");
+			Assert::AreEqual(std::size_t(1), res.size());
+			Assert::AreEqual("abc", res[0].c_str());
+		}
+
+	};
+
+	//=====   PART 8   ============================================
+	TEST_CLASS(cppstringstests_PART_8)
+	{
+	public:
+
+		TEST_METHOD(builder_append)
+		{
+			pcs::CppString abc("abc");
+			pcs::CppStringBuilder b;
+			Assert::IsTrue(b.empty());
+			b.append(abc).append("-def-").append(std::string_view("ghi")).append('j').append(pcs::CppString("klm"));
+			Assert::AreEqual(std::size_t(15), b.size());
+			Assert::AreEqual("abc-def-ghijklm", b.str().c_str());
+
+			for (int i = 0; i < 100; ++i)
+				b.append(pcs::CppString(std::to_string(i)));
+			pcs::CppString expected("abc-def-ghijklm");
+			for (int i = 0; i < 100; ++i)
+				expected += std::to_string(i);
+			Assert::AreEqual(expected.size(), b.size());
+			Assert::AreEqual(expected.c_str(), b.str().c_str());
+
+			b.clear();
+			Assert::IsTrue(b.empty());
+			Assert::AreEqual("", b.str().c_str());
+			b.append(pcs::CppString(10000, 'x'));
+			Assert::AreEqual(pcs::CppString(10000, 'x').c_str(), b.str().c_str());
+
+			pcs::CppWStringBuilder wb;
+			wb.append(L"abc").append(L'd').append(pcs::CppWString(L"ef"));
+			Assert::AreEqual(L"abcdef", wb.str().c_str());
+
+			b.clear();
+			b.append("[").append(pcs::fill(3, '.') + abc + '!').append(pcs::concat(abc)).append("]");
+			Assert::AreEqual(std::size_t(12), b.size());
+			Assert::AreEqual("[...abc!abc]", b.str().c_str());
+		}
+
+		TEST_METHOD(builder_append_fill)
+		{
+			pcs::CppStringBuilder b;
+			b.append_fill(3, '.').append("abc").append_fill(0, '#').append_fill(2, '#');
+			Assert::AreEqual(std::size_t(8), b.size());
+			Assert::AreEqual("...abc##", b.str().c_str());
+
+			pcs::CppWStringBuilder wb;
+			wb.append_fill(2, L'*');
+			Assert::AreEqual(L"**", wb.str().c_str());
+		}
+
+		TEST_METHOD(builder_append_format)
+		{
+			pcs::CppStringBuilder b;
+			b.append("x=").append_format("{:d}, y={:.2f}", 12, 3.14159).append(';');
+			Assert::AreEqual("x=12, y=3.14;", b.str().c_str());
+
+			const std::string big(10000, 'z');
+			b.append_format("{}", big);
+			Assert::AreEqual(std::size_t(13 + 10000), b.size());
+			Assert::AreEqual(("x=12, y=3.14;" + big).c_str(), b.str().c_str());
+
+			b.clear();
+			for (int i = 0; i < 1000; ++i)
+				b.append_format("{},", i);
+			std::string expected;
+			for (int i = 0; i < 1000; ++i)
+				expected += std::to_string(i) + ",";
+			Assert::AreEqual(expected.c_str(), b.str().c_str());
+
+			pcs::CppWStringBuilder wb;
+			wb.append_format(L"{}-{}", 1, L"abc");
+			Assert::AreEqual(L"1-abc", wb.str().c_str());
+		}
+
+		TEST_METHOD(builder_append_join)
+		{
+			const std::vector<pcs::CppString> words{ "a", "bc", "", "def" };
+			pcs::CppStringBuilder b;
+			b.append_join(", ", words);
+			Assert::AreEqual(std::size_t(12), b.size());
+			Assert::AreEqual("a, bc, , def", b.str().c_str());
+
+			b.clear();
+			b.append_join(", ", std::vector<pcs::CppString>{});
+			Assert::AreEqual("", b.str().c_str());
+		}
+
+		TEST_METHOD(builder_build_into)
+		{
+			pcs::CppStringBuilder b;
+			b.append("def").append_fill(2, '!');
+			pcs::CppString s("abc");
+			b.build_into(s);
+			Assert::AreEqual("abcdef!!", s.c_str());
+		}
+
+	};
+
+	//=====   PART 9   ============================================
+	TEST_CLASS(cppstringstests_PART_9)
+	{
+	public:
+
+		TEST_METHOD(concat)
+		{
+			using namespace pcs;
+			const CppString a("abc"), sep(", "), b("de");
+			CppString res = pcs::concat(a, sep, b);
+			Assert::AreEqual("abc, de", res.c_str());
+
+			res = pcs::concat(a) + sep + b + sep + "lit" + 'x' + std::string_view("sv");
+			Assert::AreEqual("abc, de, litxsv", res.c_str());
+
+			res = pcs::concat(CppString("tmp1")) + CppString("tmp2");
+			Assert::AreEqual("tmp1tmp2", res.c_str());
+
+			auto expr = pcs::concat(a) + '.' + b;
+			Assert::AreEqual(std::size_t(6), expr.size());
+			Assert::AreEqual("abc.de", expr.str().c_str());
+
+			CppString out("pre:");
+			expr.append_to(out);
+			Assert::AreEqual("pre:abc.de", out.c_str());
+
+			const CppWString wa(L"abc");
+			CppWString wres = pcs::concat(wa) + L'-' + L"def";
+			Assert::AreEqual(L"abc-def", wres.c_str());
+		}
+
+		TEST_METHOD(fill)
+		{
+			using namespace pcs;
+			const CppString a("abc");
+			CppString res = pcs::fill(2, '-') + a + pcs::fill(3, '.');
+			Assert::AreEqual("--abc...", res.c_str());
+
+			res = pcs::fill(0, '-') + a;
+			Assert::AreEqual("abc", res.c_str());
+
+			res = pcs::concat(pcs::fill(4, '#'));
+			Assert::AreEqual("####", res.c_str());
+
+			CppWString wres = pcs::fill(2, L'*') + L"x";
+			Assert::AreEqual(L"**x", wres.c_str());
+		}
+
+	};
+
+	//=====   PART 10   ===========================================
+	TEST_CLASS(cppstringstests_PART_10)
+	{
+	public:
+
+		TEST_METHOD(case_insensitive_functors)
+		{
+			Assert::AreEqual('a', pcs::fold_case('A'));
+			Assert::AreEqual('z', pcs::fold_case('z'));
+			Assert::AreEqual('[', pcs::fold_case('['));
+			Assert::AreEqual('\xc9', pcs::fold_case('\xc9'));
+			Assert::AreEqual(L'q', pcs::fold_case(L'Q'));
+
+			std::uint64_t word;
+			std::memcpy(&word, "AZaz@[\xc1`", 8);
+			word = pcs::fold_ascii_case(word);
+			Assert::AreEqual(0, std::memcmp(&word, "azaz@[\xc1`", 8));
+
+			Assert::IsTrue(pcs::IEqual{}("Content-Length", "CONTENT-length"));
+			Assert::IsFalse(pcs::IEqual{}("Content-Length", "Content-Lengths"));
+			Assert::IsFalse(pcs::IEqual{}("a[", "A{"));
+			Assert::IsTrue(pcs::WIEqual{}(L"MiXeD", L"mixed"));
+
+			Assert::AreEqual(pcs::IHash{}("Content-Length"), pcs::IHash{}("CONTENT-length"));
+			Assert::AreEqual(pcs::Hash{}("content-length"), pcs::IHash{}("Content-Length"));
+			const pcs::CppString long_upper(1000, 'K');
+			Assert::AreEqual(pcs::IHash{}(long_upper), pcs::IHash{}(pcs::CppString(1000, 'k')));
+			Assert::AreEqual(pcs::WIHash{}(L"ABC"), pcs::WIHash{}(L"abc"));
+			Assert::AreEqual(pcs::Hash{}(pcs::CppString(1000, 'k')), pcs::IHash{}(long_upper));
+			for (const std::size_t size : { 0, 1, 3, 7, 16, 17, 49, 300 }) {
+				pcs::CppString mixed, lower;
+				pcs::CppWString wmixed, wlower;
+				for (std::size_t index = 0; index < size; ++index) {
+					mixed.push_back(char((index % 2 ? 'A' : 'a') + index % 26));
+					lower.push_back(char('a' + index % 26));
+					wmixed.push_back(wchar_t((index % 3 ? L'A' : L'a') + index % 26));
+					wlower.push_back(wchar_t(L'a' + index % 26));
+				}
+				Assert::AreEqual(pcs::Hash{}(lower), pcs::IHash{}(mixed));
+				Assert::AreEqual(pcs::WHash{}(wlower), pcs::WIHash{}(wmixed));
+			}
+
+			Assert::IsTrue(pcs::ILess{}("apple", "BANANA"));
+			Assert::IsFalse(pcs::ILess{}("BANANA", "apple"));
+			Assert::IsFalse(pcs::ILess{}("Apple", "aPPLE"));
+			Assert::IsTrue(pcs::ILess{}("apple", "APPLES"));
+			Assert::IsTrue(pcs::ILess{}("abcdefgh-a", "ABCDEFGH-B"));
+
+			std::unordered_map<pcs::CppString, int, pcs::IHash, pcs::IEqual> headers;
+			headers["Content-Type"] = 1;
+			headers["ACCEPT"] = 2;
+			Assert::AreEqual(1, headers.find("content-type")->second);
+			Assert::AreEqual(2, headers.find(std::string_view("Accept"))->second);
+			Assert::IsTrue(headers.find("accepts") == headers.end());
+
+			std::map<pcs::CppString, int, pcs::ILess> sorted{ { "b", 1 }, { "A", 2 }, { "C", 3 } };
+			Assert::AreEqual("A", sorted.begin()->first.c_str());
+			Assert::AreEqual(1, sorted.find("B")->second);
+		}
+
+		TEST_METHOD(charset)
+		{
+			pcs::CharSet set("abc");
+			Assert::IsTrue(set.contains('a'));
+			Assert::IsTrue(set('c'));
+			Assert::IsFalse(set.contains('d'));
+			Assert::IsFalse(set.contains('\xff'));
+			set.add('\xff').remove('a');
+			Assert::IsTrue(set.contains('\xff'));
+			Assert::IsFalse(set.contains('a'));
+			Assert::IsFalse(set.empty());
+			Assert::IsTrue(pcs::CharSet().empty());
+			Assert::IsTrue(pcs::CharSet{ 'x', 'y' }.contains('y'));
+
+			pcs::WCharSet wset(L"a\u00e9\u4e2d\U0001F600");
+			Assert::IsTrue(wset.contains(L'a'));
+			Assert::IsTrue(wset.contains(L'\u00e9'));
+			Assert::IsTrue(wset.contains(L'\u4e2d'));
+			Assert::IsFalse(wset.contains(L'\u4e2e'));
+			Assert::IsFalse(wset.contains(L'\u4f2d'));
+			wset.remove(L'\u4e2d');
+			Assert::IsFalse(wset.contains(L'\u4e2d'));
+			Assert::IsTrue(wset.contains(L'\u00e9'));
+
+			Assert::IsTrue(pcs::WCharSet::whitespaces().contains(L'\u2003'));
+			Assert::IsFalse(pcs::WCharSet::whitespaces().contains(L'\u200b'));
+			Assert::IsTrue(pcs::CharSet::whitespaces().contains('\v'));
+
+			pcs::CharSetT<char32_t> uset{ U'\U0010FFFF', char32_t(0x7fffffff) };
+			Assert::IsTrue(uset.contains(U'\U0010FFFF'));
+			Assert::IsFalse(uset.contains(U'\U0010FFFE'));
+			Assert::IsTrue(uset.contains(char32_t(0x7fffffff)));
+			Assert::IsFalse(uset.contains(char32_t(0x7ffffffe)));
+			uset.remove(char32_t(0x7fffffff)).remove(U'\U0010FFFF');
+			Assert::IsTrue(uset.empty());
+		}
+
+		TEST_METHOD(hashed_string)
+		{
+			const pcs::CppHashedString key("price");
+			Assert::AreEqual(pcs::Hash{}("price"), key.hash());
+			Assert::AreEqual(key.hash(), std::hash<pcs::CppHashedString>{}(key));
+			Assert::AreEqual("price", key.c_str());
+			Assert::IsTrue(key == pcs::CppHashedString(pcs::CppString("price")));
+			Assert::IsFalse(key == pcs::CppHashedString("prices"));
+			Assert::IsTrue(key == std::string_view("price"));
+
+			pcs::CppHashedString copy(key);
+			Assert::AreEqual(key.hash(), copy.hash());
+			pcs::CppHashedString moved(std::move(copy));
+			Assert::AreEqual(key.hash(), moved.hash());
+			moved = pcs::CppHashedString("other");
+			Assert::AreEqual(pcs::Hash{}("other"), moved.hash());
+
+			std::unordered_set<pcs::CppHashedString, pcs::Hash, pcs::Equal> keys;
+			keys.emplace("price");
+			keys.emplace("volume");
+			Assert::IsTrue(keys.contains(key));
+			Assert::IsTrue(keys.contains("volume"));
+			Assert::IsFalse(keys.contains(pcs::CppString("open")));
+
+			const pcs::CppWHashedString wkey(L"cl\u00e9");
+			Assert::AreEqual(pcs::WHash{}(L"cl\u00e9"), wkey.hash());
+		}
+
+		TEST_METHOD(hashing)
+		{
+			// reference values of wyhash
+			Assert::AreEqual(std::uint64_t(0x93228a4de0eec5a2), pcs::hash_bytes("", 0, 0));
+			Assert::AreEqual(std::uint64_t(0xc5bac3db178713c4), pcs::hash_bytes("a", 1, 1));
+			Assert::AreEqual(std::uint64_t(0xa97f2f7b1d9b3314), pcs::hash_bytes("abc", 3, 2));
+			const char* const digits{ "12345678901234567890123456789012345678901234567890123456789012345678901234567890" };
+			Assert::AreEqual(std::uint64_t(0x6cc5eab49a92d617), pcs::hash_bytes(digits, std::strlen(digits), 6));
+
+			const pcs::CppString s("a key");
+			const std::size_t h{ std::hash<pcs::CppString>{}(s) };
+			Assert::AreEqual(h, pcs::Hash{}(s));
+			Assert::AreEqual(h, pcs::Hash{}("a key"));
+			Assert::AreEqual(h, pcs::Hash{}(std::string_view("a key")));
+			Assert::AreEqual(h, pcs::Hash{}(std::string("a key")));
+			Assert::IsTrue(h != pcs::Hash{}("a kez"));
+			Assert::AreEqual(std::hash<pcs::CppWString>{}(pcs::CppWString(L"a key")), pcs::WHash{}(L"a key"));
+			Assert::IsTrue(pcs::Equal{}(s, "a key"));
+			Assert::IsFalse(pcs::Equal{}("a key", std::string_view("a")));
+
+			std::unordered_map<pcs::CppString, int, pcs::Hash, pcs::Equal> counts;
+			counts["apples"] = 3;
+			counts.emplace("kiwis", 12);
+			Assert::AreEqual(3, counts.find("apples")->second);
+			Assert::AreEqual(12, counts.find(std::string_view("kiwis"))->second);
+			Assert::IsTrue(counts.find("pears") == counts.end());
+
+			std::unordered_set<pcs::CppString> strings{ "x", "y" };
+			Assert::IsTrue(strings.contains(pcs::CppString("y")));
+		}
+
+		TEST_METHOD(replacer)
+		{
+			const std::vector<std::pair<std::string, std::string>> pairs{ {"\r\n", "\n"}, {"\t", "    "}, {"\r", "\n"} };
+			const pcs::Replacer replacer(pairs);
+			Assert::AreEqual(std::size_t(3), replacer.size());
+			Assert::AreEqual("a\nb    c\n", replacer.replace("a\r\nb\tc\r").c_str());
+			Assert::AreEqual("no change", replacer("no change").c_str());
+			Assert::AreEqual("\n\n", pcs::CppString("\r\r\n").replace_many(replacer).c_str());
+
+			std::vector<std::thread> threads;
+			std::vector<pcs::CppString> results(4);
+			for (std::size_t t = 0; t < results.size(); ++t)
+				threads.emplace_back([&replacer, &results, t] { results[t] = replacer("x\ty\r\n"); });
+			for (auto& th : threads)
+				th.join();
+			for (const auto& res : results)
+				Assert::AreEqual("x    y\n", res.c_str());
+
+			const pcs::WReplacer wreplacer{ {L"ab", L"1"}, {L"abc", L"2"}, {L"b", L"3"} };
+			Assert::AreEqual(L"231", wreplacer(L"abcbab").c_str());
+		}
+
+
+		TEST_METHOD(sort_by_key)
+		{
+			std::vector<pcs::CppString> files{ "file10.txt", "File2.txt", "file1.txt", "file2.txt", "\xc3\xa9t\xc3\xa9.txt", "ete.txt", "file01.txt" };
+			pcs::sort_by_key(files, true);
+			Assert::AreEqual(std::size_t(7), files.size());
+			Assert::AreEqual("ete.txt", files[0].c_str());
+			Assert::AreEqual("\xc3\xa9t\xc3\xa9.txt", files[1].c_str());
+			Assert::AreEqual("file1.txt", files[2].c_str());
+			Assert::AreEqual("file01.txt", files[3].c_str());
+			Assert::AreEqual("file2.txt", files[4].c_str());
+			Assert::AreEqual("File2.txt", files[5].c_str());
+			Assert::AreEqual("file10.txt", files[6].c_str());
+
+			pcs::sort_by_key(files);
+			Assert::AreEqual("file01.txt", files[2].c_str());
+			Assert::AreEqual("file10.txt", files[4].c_str());
+
+			std::vector<pcs::CppString> same{ "b", "a", "b", "a" };
+			pcs::sort_by_key(same);
+			Assert::AreEqual("a", same[0].c_str());
+			Assert::AreEqual("b", same[3].c_str());
+
+			std::vector<pcs::CppWString> wfiles{ L"b10", L"B9", L"a" };
+			pcs::sort_by_key(wfiles, true);
+			Assert::AreEqual(L"a", wfiles[0].c_str());
+			Assert::AreEqual(L"B9", wfiles[1].c_str());
+			Assert::AreEqual(L"b10", wfiles[2].c_str());
+
+			std::vector<pcs::CppString> none{};
+			pcs::sort_by_key(none);
+			Assert::IsTrue(none.empty());
+		}
+
+		TEST_METHOD(sort_strings)
+		{
+			std::vector<pcs::CppString> urls{};
+			for (int i = 0; i < 300; ++i)
+				urls.emplace_back(std::format("https://www.example.com/{}/item/{}", i % 7, (i * 7919) % 300));
+			urls.emplace_back("https://www.example.com/");
+			urls.emplace_back("");
+			urls.emplace_back(std::string("https://www.example.com/\0", 25));
+			urls.emplace_back("https://www.example.com/\xff");
+			std::vector<pcs::CppString> expected{ urls };
+			std::sort(expected.begin(), expected.end());
+			pcs::sort_strings(urls);
+			Assert::IsTrue(urls == expected);
+
+			std::vector<pcs::CppString> big{};
+			std::uint32_t seed{ 12345 };
+			for (int i = 0; i < 40000; ++i) {
+				seed = seed * 1664525 + 1013904223;
+				big.emplace_back(std::format("/usr/share/{:x}/{}", seed % 5000, seed % 3));
+			}
+			expected = big;
+			std::sort(expected.begin(), expected.end());
+			std::vector<pcs::CppString> par_big{ big };
+			pcs::sort_strings(std::execution::par, par_big, false, 4);
+			Assert::IsTrue(par_big == expected);
+			pcs::sort_strings(std::execution::seq, big);
+			Assert::IsTrue(big == expected);
+
+			const std::string storage{ "b a b a" };
+			std::vector<std::string_view> views{ { storage.data(), 1 }, { storage.data() + 2, 1 }, { storage.data() + 4, 1 }, { storage.data() + 6, 1 } };
+			pcs::sort_strings(views, true);
+			Assert::IsTrue(views[0].data() == storage.data() + 2);
+			Assert::IsTrue(views[1].data() == storage.data() + 6);
+			Assert::IsTrue(views[2].data() == storage.data());
+			Assert::IsTrue(views[3].data() == storage.data() + 4);
+
+			std::vector<pcs::CppWString> wstrings{ L"zeta", L"alpha", L"alphabet", L"Alpha", L"" };
+			pcs::sort_strings(wstrings);
+			Assert::AreEqual(L"", wstrings[0].c_str());
+			Assert::AreEqual(L"Alpha", wstrings[1].c_str());
+			Assert::AreEqual(L"alpha", wstrings[2].c_str());
+			Assert::AreEqual(L"alphabet", wstrings[3].c_str());
+			Assert::AreEqual(L"zeta", wstrings[4].c_str());
+
+			std::vector<pcs::CppString> none{};
+			pcs::sort_strings(std::execution::par, none);
+			Assert::IsTrue(none.empty());
+		}
+
+		TEST_METHOD(string_column)
+		{
+			const std::vector<pcs::CppString> strings{ "abc", "", "de", "fghij" };
+			const pcs::StringColumn column(strings);
+			Assert::AreEqual(std::size_t(4), column.size());
+			Assert::AreEqual(std::size_t(10), column.chars_count());
+			Assert::IsTrue(column[0] == "abc");
+			Assert::IsTrue(column[1].empty());
+			Assert::IsTrue(column[3] == "fghij");
+			Assert::AreEqual(std::size_t(5), column.offsets().size());
+
+			const std::vector<pcs::CppString> back{ column.to_vector() };
+			Assert::AreEqual(strings.size(), back.size());
+			for (std::size_t i = 0; i < strings.size(); ++i)
+				Assert::AreEqual(strings[i].c_str(), back[i].c_str());
+
+			std::size_t count{ 0 };
+			for (const auto str : column.views())
+				count += str.size();
+			Assert::AreEqual(std::size_t(10), count);
+
+			pcs::StringColumn col2{ "x", "y" };
+			col2.push_back("z");
+			Assert::AreEqual(std::size_t(3), col2.size());
+			col2.clear();
+			Assert::IsTrue(col2.empty());
+
+			const pcs::WStringColumn wcolumn{ L"ab", L"c" };
+			Assert::IsTrue(wcolumn[1] == L"c");
+		}
+
+		TEST_METHOD(string_column_conversions)
+		{
+			const pcs::StringColumn column{ "1", " -2 ", "3_000", "12345678" };
+			Assert::IsTrue(column.to_int() == std::vector<int>{ 1, -2, 3000, 12345678 });
+			Assert::IsTrue(column.to_float() == std::vector<double>{ 1.0, -2.0, 3000.0, 12345678.0 });
+			Assert::IsTrue(pcs::StringColumn{ "ff", "10" }.to_int<unsigned>(16) == std::vector<unsigned>{ 255, 16 });
+
+			const pcs::StringColumn fields{ "1.5", "", "x", "1e999" };
+			const std::vector<std::expected<double, std::errc>> values{ fields.try_to_float() };
+			Assert::AreEqual(std::size_t(4), values.size());
+			Assert::AreEqual(1.5, *values[0]);
+			Assert::IsTrue(values[1].error() == std::errc::invalid_argument);
+			Assert::IsTrue(values[2].error() == std::errc::invalid_argument);
+			Assert::IsTrue(*values[3] == HUGE_VAL);
+			Assert::IsTrue(fields.try_to_int<short>()[0].error() == std::errc::invalid_argument);
+
+			Assert::ExpectException<pcs::CppString::ValueException>([&fields] { (void)fields.to_int(); });
+			Assert::ExpectException<pcs::CppString::ValueException>([] { (void)pcs::StringColumn{ "1", "1.5x" }.to_float(); });
+			Assert::ExpectException<std::out_of_range>([] { (void)pcs::StringColumn{ "1", "99999999999" }.to_int(); });
+		}
+
+		TEST_METHOD(string_column_predicates)
+		{
+			const pcs::StringColumn column{ "abcab", "cab", "", "ca", "bxab", "ab" };
+			const std::vector<bool> contains{ column.contains("ab") };
+			Assert::IsTrue(contains == std::vector<bool>{ true, true, false, false, true, true });
+			Assert::IsTrue(column.contains("ca") == std::vector<bool>{ true, true, false, true, false, false });
+			Assert::IsTrue(column.contains("bc") == std::vector<bool>{ true, false, false, false, false, false });
+			Assert::IsTrue(column.contains("") == std::vector<bool>(6, true));
+			Assert::IsTrue(column.startswith("ab") == std::vector<bool>{ true, false, false, false, false, true });
+			Assert::IsTrue(column.endswith("ab") == std::vector<bool>{ true, true, false, false, true, true });
+		}
+
+		TEST_METHOD(string_column_transforms)
+		{
+			const pcs::StringColumn column{ "  Abc ", "", "dE  f", " " };
+			const pcs::StringColumn stripped{ column.strip() };
+			Assert::IsTrue(stripped[0] == "Abc");
+			Assert::IsTrue(stripped[1].empty());
+			Assert::IsTrue(stripped[2] == "dE  f");
+			Assert::IsTrue(stripped[3].empty());
+
+			Assert::IsTrue(column.lower()[0] == "  abc ");
+			Assert::IsTrue(column.upper()[2] == "DE  F");
+			Assert::IsTrue(column.replace(" ", "_")[2] == "dE__f");
+			Assert::IsTrue(column.replace(" ", "")[0] == "Abc");
+			Assert::IsTrue(column.strip(pcs::CharSet(" A"))[0] == "bc");
+
+			const pcs::StringColumn sliced{ column.slice(1, -1) };
+			Assert::IsTrue(sliced[0] == " Abc");
+			Assert::IsTrue(sliced[2] == "E  ");
+			Assert::IsTrue(sliced[3].empty());
+			Assert::IsTrue(column.slice(-2)[2] == " f");
+
+			std::vector<std::size_t> rows;
+			const pcs::StringColumn words{ pcs::StringColumn{ "a,b", "", "c,,d" }.split(",", rows) };
+			Assert::AreEqual(std::size_t(6), words.size());
+			Assert::IsTrue(rows == std::vector<std::size_t>{ 0, 2, 3, 6 });
+			Assert::IsTrue(words[1] == "b");
+			Assert::IsTrue(words[2].empty());
+			Assert::IsTrue(words[4].empty());
+			Assert::IsTrue(words[5] == "d");
+		}
+
+		TEST_METHOD(strings_sorter)
+		{
+			std::vector<std::string> strings{};
+			std::uint32_t seed{ 987654321 };
+			for (int i = 0; i < 50000; ++i) {
+				seed = seed * 1664525 + 1013904223;
+				const std::size_t length{ (seed >> 8) % 24 };
+				std::string str(length, 'a');
+				for (std::size_t k = 0; k < length; ++k) {
+					seed = seed * 1664525 + 1013904223;
+					str[k] = char("\0abz\x80\xff"[(seed >> 16) % 6]);
+				}
+				strings.push_back(str);
+			}
+
+			pcs::StringsSorter sorter(strings);
+			Assert::AreEqual(strings.size(), sorter.size());
+			sorter.sort_parallel(true, 4);
+			for (std::size_t rank = 1; rank < sorter.size(); ++rank) {
+				Assert::IsTrue(sorter[rank - 1] <= sorter[rank]);
+				if (sorter[rank - 1] == sorter[rank])
+					Assert::IsTrue(sorter.index(rank - 1) < sorter.index(rank));
+			}
+			for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+				Assert::IsTrue(sorter[rank] == strings[sorter.index(rank)]);
+
+			pcs::StringsSorter seq_sorter(strings);
+			seq_sorter.sort(true);
+			for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+				Assert::AreEqual(sorter.index(rank), seq_sorter.index(rank));
+
+			const std::vector<std::wstring> wstrings{ L"b", L"a\u00e9", L"a" };
+			pcs::WStringsSorter wsorter(wstrings);
+			wsorter.sort();
+			Assert::AreEqual(std::size_t(2), wsorter.index(0));
+			Assert::AreEqual(std::size_t(1), wsorter.index(1));
+			Assert::AreEqual(std::size_t(0), wsorter.index(2));
+		}
+
+		TEST_METHOD(table)
+		{
+			using Align = pcs::Table::Align;
+			pcs::Table table({ Align::LEFT, Align::RIGHT, Align::CENTER });
+			table.add_row({ "name", "count", "ok" });
+			table.add_row({ "apples", "3", "y" });
+			table.add_row(std::vector<pcs::CppString>{ "kiwis", "12" });
+			Assert::AreEqual(std::size_t(3), table.rows_count());
+			Assert::AreEqual(std::size_t(3), table.columns_count());
+			Assert::IsTrue(table.widths()[0] == 6 && table.widths()[1] == 5 && table.widths()[2] == 2);
+			Assert::IsTrue(table.cell(2, 2).empty());
+
+			const pcs::CppString text{ table.str() };
+			Assert::AreEqual("name   count ok\napples     3 y \nkiwis     12   \n", text.c_str());
+			Assert::AreEqual(table.size(), text.size());
+
+			pcs::CppString out("> ");
+			table.append_to(out);
+			Assert::AreEqual(("> " + text).c_str(), out.c_str());
+
+			pcs::WTable wtable({ pcs::WTable::Align::RIGHT }, L" | ");
+			wtable.add_row({ L"a", L"bcd" }).add_row({ L"efg", L"h" });
+			Assert::AreEqual(L"  a | bcd\nefg | h  \n", wtable.str().c_str());
+			wtable.clear();
+			Assert::IsTrue(wtable.str().empty());
+		}
+
 	};
 }
@@ -23,18 +23,43 @@
 //=============================================================
 #include <algorithm>
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cassert>
 #include <cctype>
+#include <charconv>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <cwctype>
+#include <exception>
+#include <expected>
 #include <format>
+#include <functional>
 #include <limits>
 #include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
 #include <ranges>
 #include <span>
 #include <stdexcept>
+#include <string_view>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
+#if defined(_MSC_VER) && defined(_M_X64)
+#   include <intrin.h>      // _umul128()
+#endif
+
+// Overloads of methods and functions taking the standard execution policies
+// as their first argument are opt-in: define PCS_EXECUTION_POLICIES before
+// including this header to get them. Header <execution> may indeed bring in
+// a parallel backend, such as TBB with libstdc++, that has then to be linked.
+#if defined(PCS_EXECUTION_POLICIES)
+#   include <execution>
+#endif
 
 
 namespace pcs // i.e. "pythonic c++ strings"
@@ -94,7 +119,226 @@ namespace pcs // i.e. "pythonic c++ strings"
     struct StopStepSlice;                                       //!< struct of slices with default start values
 
 
+    // characters sets -- used by the strip, split_any, find_any and delete_chars methods of CppStringT.
+    template<class CharT>
+    class CharSetT;                                             //!< Base class for sets of characters
+
+    using CharSet  = CharSetT<char>;                            //!< Specialization of sets of characters with template argument 'char'
+    using WCharSet = CharSetT<wchar_t>;                         //!< Specialization of sets of characters with template argument 'wchar_t'
+
+
+    // bounded outputs -- used by the '_into()' methods of class CppStringT that write into caller-provided spans.
+    template<class CharT>
+    class BoundedOutputT;                                       //!< Outputs of characters into a span, bounded by the span size
+
+
+    // reverse splits views -- see method CppStringT::rsplit_view().
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    class RSplitViewT;                                          //!< Lazy views of the words of strings, from right to left
+
+
+    // split buffers -- used by the methods split_into() and splitlines_into() of CppStringT.
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>,
+        class AllocatorT = std::allocator<CharT>
+    > class SplitBufferT;                                       //!< Reusable buffers of the words of split strings
+
+    using SplitBuffer  = SplitBufferT<char>;                    //!< Specialization of split buffers with template argument 'char'
+    using WSplitBuffer = SplitBufferT<wchar_t>;                 //!< Specialization of split buffers with template argument 'wchar_t'
+
+
+    // interned strings -- see function pcs::intern().
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>
+    > class InternPoolT;                                        //!< Base class for pools of interned strings
+
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>
+    > class CppInternedT;                                       //!< Base class for handles to interned strings
+
+    using CppInterned  = CppInternedT<char>;                    //!< Specialization of interned strings handles with template argument 'char'
+    using CppWInterned = CppInternedT<wchar_t>;                 //!< Specialization of interned strings handles with template argument 'wchar_t'
+
+
+    // ropes -- strings stored as balanced trees of chunks, for large concatenation workloads.
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>,
+        class AllocatorT = std::allocator<CharT>
+    > class CppRopeT;                                           //!< Base class for ropes
+
+    using CppRope  = CppRopeT<char>;                            //!< Specialization of ropes with template argument 'char'
+    using CppWRope = CppRopeT<wchar_t>;                         //!< Specialization of ropes with template argument 'wchar_t'
+
+
+    // strings builders -- accumulate pieces of strings, then build the resulting string with one single allocation.
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>,
+        class AllocatorT = std::allocator<CharT>
+    > class CppStringBuilderT;                                  //!< Base class for strings builders
+
+    using CppStringBuilder  = CppStringBuilderT<char>;          //!< Specialization of strings builders with template argument 'char'
+    using CppWStringBuilder = CppStringBuilderT<wchar_t>;       //!< Specialization of strings builders with template argument 'wchar_t'
+
+
+    // lazy concatenations expressions -- see functions pcs::concat() and pcs::fill().
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct ConcatViewT;                                         //!< Terms of concatenations that reference some characters
+
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct ConcatCharT;                                         //!< Terms of concatenations that are one single character
+
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct FillRunT;                                            //!< Terms of concatenations that are runs of filling characters
+
+
+    // multiple replacements -- see method CppStringT::replace_many().
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>
+    > class ReplacerT;                                          //!< Base class for compiled sets of substitutions
+
+    using Replacer  = ReplacerT<char>;                          //!< Specialization of compiled sets of substitutions with template argument 'char'
+    using WReplacer = ReplacerT<wchar_t>;                       //!< Specialization of compiled sets of substitutions with template argument 'wchar_t'
+
+
+    // strings columns -- contiguous storage of many strings, with batch versions of the pythonic methods.
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>
+    > class StringColumnT;                                      //!< Base class for columns of strings
+
+    using StringColumn  = StringColumnT<char>;                  //!< Specialization of columns of strings with template argument 'char'
+    using WStringColumn = StringColumnT<wchar_t>;               //!< Specialization of columns of strings with template argument 'wchar_t'
+
+
+    // tables -- rows of cells rendered with aligned columns.
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>,
+        class AllocatorT = std::allocator<CharT>
+    > class TableT;                                             //!< Base class for tables of strings
+
+    using Table  = TableT<char>;                                //!< Specialization of tables with template argument 'char'
+    using WTable = TableT<wchar_t>;                             //!< Specialization of tables with template argument 'wchar_t'
+
+
+    // numbers conversions -- used by the 'to_int()', 'to_float()' and 'try_to_...()' methods of CppStringT and of StringColumnT.
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    class NumberCharsT;                                         //!< The ASCII characters of numbers written in strings
+
+    template<class IntT, class CharT, class TraitsT>
+        requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+    std::expected<IntT, std::errc> try_to_int(const std::basic_string_view<CharT, TraitsT> str, int base = 10);  //!< Returns the integer written in str, as Python int() does, or an error code.
+
+    template<class FloatT, class CharT, class TraitsT>
+        requires std::floating_point<FloatT>
+    std::expected<FloatT, std::errc> try_to_float(const std::basic_string_view<CharT, TraitsT> str);  //!< Returns the floating-point number written in str, as Python float() does, or an error code.
+
+
+    // hashing -- 64-bits hashing of strings, with transparent functors for heterogeneous lookups in unordered containers.
+    inline std::uint64_t hash_bytes(const void* data, const std::size_t size, const std::uint64_t seed = 0) noexcept;  //!< Returns the 64-bits hash value of size bytes at data.
+
+    template<class LoadT>
+        requires std::is_nothrow_invocable_v<const LoadT&, void*, std::size_t, std::size_t>
+    std::uint64_t hash_bytes(const LoadT& load, const std::size_t size, std::uint64_t seed) noexcept;  //!< Returns the 64-bits hash value of size bytes loaded by load().
+
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct HashT;                                               //!< Transparent hashing of strings, views and null-terminated strings
+
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct EqualT;                                              //!< Transparent equality of strings, views and null-terminated strings
+
+    using Hash   = HashT<char>;                                 //!< Specialization of transparent hashing with template argument 'char'
+    using WHash  = HashT<wchar_t>;                              //!< Specialization of transparent hashing with template argument 'wchar_t'
+    using Equal  = EqualT<char>;                                //!< Specialization of transparent equality with template argument 'char'
+    using WEqual = EqualT<wchar_t>;                             //!< Specialization of transparent equality with template argument 'wchar_t'
+
+    template<
+        class CharT,
+        class TraitsT = std::char_traits<CharT>,
+        class AllocatorT = std::allocator<CharT>
+    > class CppHashedStringT;                                   //!< Base class for immutable strings that cache their hash value
+
+    using CppHashedString  = CppHashedStringT<char>;            //!< Specialization of hashed strings with template argument 'char'
+    using CppWHashedString = CppHashedStringT<wchar_t>;         //!< Specialization of hashed strings with template argument 'wchar_t'
+
+
+    // case-insensitive comparisons -- transparent functors for unordered and ordered containers with case-insensitive keys.
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct IHashT;                                              //!< Transparent case-insensitive hashing of strings
+
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct IEqualT;                                             //!< Transparent case-insensitive equality of strings
+
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    struct ILessT;                                              //!< Transparent case-insensitive ordering of strings
+
+    using IHash   = IHashT<char>;                               //!< Specialization of case-insensitive hashing with template argument 'char'
+    using WIHash  = IHashT<wchar_t>;                            //!< Specialization of case-insensitive hashing with template argument 'wchar_t'
+    using IEqual  = IEqualT<char>;                              //!< Specialization of case-insensitive equality with template argument 'char'
+    using WIEqual = IEqualT<wchar_t>;                           //!< Specialization of case-insensitive equality with template argument 'wchar_t'
+    using ILess   = ILessT<char>;                               //!< Specialization of case-insensitive ordering with template argument 'char'
+    using WILess  = ILessT<wchar_t>;                            //!< Specialization of case-insensitive ordering with template argument 'wchar_t'
+
+
+    // strings sorting -- multikey quicksort of strings, see function pcs::sort_strings().
+    template<class CharT, class TraitsT = std::char_traits<CharT>>
+    class StringsSorterT;                                       //!< Base class for sorters of strings, with cached prefixes of strings
+
+    using StringsSorter  = StringsSorterT<char>;                //!< Specialization of sorters of strings with template argument 'char'
+    using WStringsSorter = StringsSorterT<wchar_t>;             //!< Specialization of sorters of strings with template argument 'wchar_t'
+
+    template<class CharT, class TraitsT, class AllocatorT>
+    void sort_strings(std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings, const bool stable = false);  //!< Sorts strings in lexicographical order.
+
+    template<class CharT, class TraitsT>
+    void sort_strings(std::vector<std::basic_string_view<CharT, TraitsT>>& views, const bool stable = false);    //!< Sorts views in lexicographical order.
+
+#if defined(PCS_EXECUTION_POLICIES)
+    template<class ExecutionPolicyT, class CharT, class TraitsT, class AllocatorT>
+        requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+    void sort_strings(ExecutionPolicyT&&, std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings, const bool stable = false, const std::size_t threads_count = 0);  //!< Sorts strings in lexicographical order, on several threads with parallel policies.
+
+    template<class ExecutionPolicyT, class CharT, class TraitsT>
+        requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+    void sort_strings(ExecutionPolicyT&&, std::vector<std::basic_string_view<CharT, TraitsT>>& views, const bool stable = false, const std::size_t threads_count = 0);    //!< Sorts views in lexicographical order, on several threads with parallel policies.
+#endif
+
+
+    // collation -- sorting of strings in the locale-free order of their collation keys, see method CppStringT::sort_key().
+    template<class CharT, class TraitsT, class AllocatorT>
+    void sort_by_key(std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings, const bool natural = false);  //!< Sorts strings in the order of their collation keys.
+
+
+    // parallel processing -- used by the '_parallel()' methods of CppStringT and by StringColumnT.
+    inline constexpr std::size_t PARALLEL_MIN_CHARS{ 1 << 16 }; //!< Minimal count of characters per chunk of strings processed in parallel
+    inline constexpr std::size_t PARALLEL_MIN_ITEMS{ 1 << 12 }; //!< Minimal count of items per chunk of containers processed in parallel
+
+    inline std::size_t parallel_chunks_count(const std::size_t count, std::size_t threads_count, const std::size_t min_chunk_size) noexcept;  //!< Returns the count of chunks a range of count items gets cut into.
+
+    template<class FuncT>
+    void parallel_for_chunks(const std::size_t count, const std::size_t chunks_count, FuncT&& func);  //!< Runs func on each chunk of a range of count items, each chunk on its own thread.
+
+#if defined(PCS_EXECUTION_POLICIES)
+    template<class ExecutionPolicyT>
+    inline constexpr bool is_parallel_policy_v{                 //!< True for the execution policies that run on several threads, i.e. std::execution::par and par_unseq.
+        std::is_same_v<std::remove_cvref_t<ExecutionPolicyT>, std::execution::parallel_policy> ||
+        std::is_same_v<std::remove_cvref_t<ExecutionPolicyT>, std::execution::parallel_unsequenced_policy>
+    };
+#endif
+
+
     // chars classifications -- not to be directly called, see respective specializations at the very end of this module.
+    template<class CharT>
+    inline const CharT fold_case(const CharT ch) noexcept;      //!< Returns the case folded form of character ch, for case-insensitive comparisons.
+
+    inline std::uint64_t fold_ascii_case(const std::uint64_t word) noexcept;  //!< Returns the eight chars packed in word with their ASCII uppercase letters lowered.
+
     template<class CharT>
     inline const bool is_alpha(const CharT ch) noexcept;        //!< Returns true if character ch is alphabetic, or false otherwise.
 
@@ -158,8 +402,10 @@ namespace pcs // i.e. "pythonic c++ strings"
     *   - char8_t  (C++20)
     *   - char16_t (C++11)
     *   - char32_t (C++11)
-    * Caution:  templated method format() may be difficult to specialize
-    *           with these types --> let us know if you succeed!
+    * Caution:  std::format() is only available with char and wchar_t. So,
+    *           methods format() and format_append() of these specializations
+    *           take UTF-8 char format strings, the formatted texts being then
+    *           transcoded into UTF-8, UTF-16 or UTF-32.
     */
     template<class CharT, class TraitsT, class AllocatorT>
     class CppStringT : public std::basic_string<CharT, TraitsT, AllocatorT>
@@ -435,6 +681,15 @@ namespace pcs // i.e. "pythonic c++ strings"
             inline NotFoundException(const char* what_arg) : MyBaseClass(what_arg) {}
         };
 
+        class ValueException : public std::invalid_argument
+        {
+        public:
+            using MyBaseClass = std::invalid_argument;
+
+            inline ValueException(const std::string& what_arg) : MyBaseClass(what_arg) {}
+            inline ValueException(const char* what_arg) : MyBaseClass(what_arg) {}
+        };
+
 
         //===   Methods   =========================================
 
@@ -466,7 +721,36 @@ namespace pcs // i.e. "pythonic c++ strings"
                 return CppStringT(*this);
 
             const size_type half{ (width - len) / 2 };
-            return CppStringT(half, fillch) + *this + CppStringT(width - half - len, fillch);
+            return FillRunT<CharT, TraitsT>{ half, fillch } + *this + FillRunT<CharT, TraitsT>{ width - half - len, fillch };
+        }
+
+
+        //---   center_into()   -----------------------------------
+        /** \brief Outputs the string centered in a string of length width via output iterator out, as center() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt center_into(OutputIt out, const size_type width, const value_type fillch = value_type(' ')) const
+        {
+            const size_type len{ this->size() };
+            if (width <= len) [[unlikely]]
+                return std::copy(this->cbegin(), this->cend(), out);
+
+            const size_type half{ (width - len) / 2 };
+            out = std::fill_n(out, half, fillch);
+            out = std::copy(this->cbegin(), this->cend(), out);
+            return std::fill_n(out, width - half - len, fillch);
+        }
+
+        /** \brief Writes the string centered in a string of length width into the caller-provided span dest, as center() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type center_into(std::span<CharT> dest, const size_type width, const value_type fillch = value_type(' ')) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->center_into(output.begin(), width, fillch);
+            return output.count();
         }
 
 
@@ -502,6 +786,34 @@ namespace pcs // i.e. "pythonic c++ strings"
 #endif
         }
 
+        /** \brief Returns true if this string contains the passed character, or false otherwise. */
+        [[nodiscard]]
+        inline bool contains(const value_type ch) const noexcept
+        {
+            return TraitsT::find(this->data(), this->size(), ch) != nullptr;
+        }
+
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns true if this string contains the passed string, or false otherwise, searching on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings, which get cut into chunks searched on
+        * threads_count threads (0 stands for the count of hardware threads),
+        * chunks overlapping by substr.size() - 1 characters. All the threads
+        * stop as soon as one of them finds substr. Other policies run method
+        * contains(substr) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        bool contains(ExecutionPolicyT&&, const CppStringT& substr, const size_type threads_count = 0) const
+        {
+            if constexpr (is_parallel_policy_v<ExecutionPolicyT>)
+                return substr.empty() || _parallel_find(substr, threads_count, true) != CppStringT::npos;
+            else
+                return contains(substr);
+        }
+#endif
+
 
         //---   contains_n()   ------------------------------------
         /** \brief Returns true if the passed string is found within the slice str[start:start+count-1], or false otherwise.
@@ -542,6 +854,64 @@ namespace pcs // i.e. "pythonic c++ strings"
             return n;
         }
 
+        /** \brief Returns the number of occurrences of character ch in the range [start, end].
+        *
+        * With characters of one byte,  eight characters are compared  at
+        * once within 64-bit words, matches being counted via popcount.
+        */
+        [[nodiscard]]
+        size_type count(const value_type ch, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            if (start >= this->size()) [[unlikely]]
+                return 0;
+
+            const CharT* first{ this->data() + start };
+            const CharT* const last{ this->data() + ((end >= this->size()) ? this->size() : end + 1) };
+            if (first >= last) [[unlikely]]
+                return 0;
+            size_type n{ 0 };
+
+            if constexpr (sizeof(CharT) == 1) {
+                constexpr std::uint64_t ONES{ 0x0101'0101'0101'0101ull };
+                constexpr std::uint64_t LOW7{ 0x7f7f'7f7f'7f7f'7f7full };
+                const std::uint64_t pattern{ ONES * static_cast<unsigned char>(ch) };
+                for (; last - first >= 8; first += 8) {
+                    std::uint64_t word;
+                    std::memcpy(&word, first, 8);
+                    const std::uint64_t diff{ word ^ pattern };
+                    // the high bit of each byte gets set if and only if this byte of diff is not null
+                    const std::uint64_t not_null{ (((diff & LOW7) + LOW7) | diff) & ~LOW7 };
+                    n += 8 - std::popcount(not_null);
+                }
+            }
+
+            return n + size_type(std::count(first, last, ch));
+        }
+
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns the number of non-overlapping occurrences of substring sub in the whole string, counting on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings, which get cut into chunks searched on
+        * threads_count threads (0 stands for the count of hardware threads),
+        * chunks overlapping by sub.size() - 1 characters.  Occurrences that
+        * straddle two chunks are fixed up afterwards,  so that the count is
+        * exactly the one of count(sub),  even with self-overlapping strings
+        * such as "aa". Other policies run method count(sub) on the calling
+        * thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        size_type count(ExecutionPolicyT&&, const CppStringT& sub, const size_type threads_count = 0) const
+        {
+            if constexpr (is_parallel_policy_v<ExecutionPolicyT>) {
+                if (!sub.empty()) [[likely]]
+                    return _parallel_count(sub, threads_count);
+            }
+            return count(sub);
+        }
+#endif
+
 
         //---   count_n()   ---------------------------------------
         /** \brief Returns the number of non-overlapping occurrences of substring sub in the range [start, start+length-1]. */
@@ -559,6 +929,44 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   delete_chars()   ----------------------------------
+        /** \brief Returns a copy of the string with all the characters that are in set removedchars deleted.
+        *
+        * Characters are compacted within one single branch-free pass. This
+        * is a template, constrained to sets of characters, so that braced
+        * lists of characters select delete_chars(const CppStringT&).
+        */
+        template<class SetT>
+            requires std::same_as<SetT, CharSetT<CharT>>
+        [[nodiscard]]
+        CppStringT delete_chars(const SetT& removedchars) const
+        {
+            CppStringT res{};
+            const auto compact = [this, &removedchars](CharT* out) noexcept {
+                size_type count{ 0 };
+                for (const value_type ch : *this) {
+                    out[count] = ch;
+                    count += size_type(!removedchars.contains(ch));
+                }
+                return count;
+            };
+#if defined(__cpp_lib_string_resize_and_overwrite)
+            res.resize_and_overwrite(this->size(), [&compact](CharT* out, std::size_t) noexcept { return compact(out); });
+#else
+            res.resize(this->size());
+            res.resize(compact(res.data()));
+#endif
+            return res;
+        }
+
+        /** \brief Returns a copy of the string with all the characters of removedchars deleted. */
+        [[nodiscard]]
+        inline CppStringT delete_chars(const CppStringT& removedchars) const
+        {
+            return delete_chars(CharSetT<CharT>(removedchars));
+        }
+
+
         //---   endswith()   --------------------------------------
         /** \brief Returns true if the string ends with the specified suffix, otherwise returns false. Test begins at start position and stops at end position. */
         [[nodiscard]]
@@ -621,32 +1029,249 @@ namespace pcs // i.e. "pythonic c++ strings"
 
 
         //---   expand_tabs()   -----------------------------------
-        /** \brief Returns a copy of the string where all tab characters are replaced by one or more spaces, depending on the current column and the given tab size. */
+        /** \brief Returns a copy of the string where all tab characters are replaced by one or more spaces, depending on the current column and the given tab size.
+        *
+        * A first pass over the string computes the exact size of the result,
+        * which is then allocated once and filled in a second pass with runs
+        * of copied characters and runs of spaces. Both passes jump from tab
+        * or line break to the next one,  eight characters at a time in char
+        * strings.
+        */
         [[nodiscard]]
         CppStringT expand_tabs(const size_type tabsize = 8) const noexcept
         {
             const size_type tabsize_{ tabsize == 0 ? 1 : tabsize };
-            CppStringT ret{};
+            const CharT* const first{ this->data() };
+            const CharT* const last{ first + this->size() };
+
+            // first pass: computes the exact size of the result
+            size_type tabs_count{ 0 };
+            const size_type res_size{ _expanded_tabs_size(tabsize_, tabs_count) };
+            if (tabs_count == 0) [[unlikely]]
+                return *this;
+
+            // second pass: copies the runs of characters and fills the tabs with spaces
+            const auto fill = [tabsize_, first, last](CharT* out) noexcept {
+                const CharT* run{ first };
+                for (const CharT* stop; (stop = _find_tab_or_eol(run, last)) != last; run = stop + 1) {
+                    const size_type run_size{ size_type(stop - run) };
+                    TraitsT::copy(out, run, run_size);
+                    out += run_size;
+                    if (*stop == value_type('\t')) {
+                        const size_type spaces_count{ tabsize_ - run_size % tabsize_ };
+                        TraitsT::assign(out, spaces_count, value_type(' '));
+                        out += spaces_count;
+                    }
+                    else
+                        *out++ = *stop;
+                }
+                TraitsT::copy(out, run, size_type(last - run));
+            };
+
+            CppStringT res{};
+#if defined(__cpp_lib_string_resize_and_overwrite)
+            res.resize_and_overwrite(res_size, [&fill, res_size](CharT* out, std::size_t) noexcept {
+                fill(out);
+                return res_size;
+            });
+#else
+            res.resize(res_size);
+            fill(res.data());
+#endif
+            return res;
+        }
+
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns a copy of the string where all tab characters are replaced by spaces, as expand_tabs(tabsize) does, expanding on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings, cut into chunks processed on
+        * threads_count threads (0 stands for the count of hardware threads).
+        * Tabs widths only depend on the current column modulo tabsize, which
+        * is reset by line breaks and tabs. So, each chunk is first scanned
+        * from column 0, its length and final column being then fixed up for
+        * the actual column at its start, chunk after chunk. The result is
+        * then allocated once and filled in parallel.  Other policies run
+        * method expand_tabs(tabsize) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        CppStringT expand_tabs(ExecutionPolicyT&&, const size_type tabsize = 8, const size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                return expand_tabs(tabsize);
+            else {
+                struct ChunkState { size_type out_size, end_column, head_size; bool head_ends_with_tab, head_only; };
+
+                const size_type tabsize_{ tabsize == 0 ? 1 : tabsize };
+                const CharT* const chars{ this->data() };
+
+                // expands the chunk [first, last) starting at column, into out when not null, and returns its state, head being the characters before the first tab or line break
+                const auto expand = [tabsize_, chars](const size_type first, const size_type last, size_type column, CharT* out) {
+                    ChunkState state{ 0, 0, last - first, false, true };
+                    for (size_type index = first; index < last; ++index) {
+                        const value_type ch{ chars[index] };
+                        if (ch == value_type('\t')) [[unlikely]] {
+                            const size_type spaces_count{ tabsize_ - column };
+                            if (out != nullptr)
+                                out = std::fill_n(out, spaces_count, value_type(' '));
+                            state.out_size += spaces_count;
+                            column = 0;
+                            if (state.head_only) {
+                                state.head_size = index - first;
+                                state.head_ends_with_tab = true;
+                                state.head_only = false;
+                            }
+                            continue;
+                        }
+                        if (ch == value_type('\n') || ch == value_type('\r')) [[unlikely]] {
+                            column = 0;
+                            if (state.head_only) {
+                                state.head_size = index - first;
+                                state.head_only = false;
+                            }
+                        }
+                        else [[likely]] {
+                            column = (column + 1 == tabsize_) ? 0 : column + 1;
+                        }
+                        if (out != nullptr)
+                            *out++ = ch;
+                        ++state.out_size;
+                    }
+                    state.end_column = column;
+                    return state;
+                };
+
+                const size_type chunks_count{ parallel_chunks_count(this->size(), threads_count, PARALLEL_MIN_CHARS) };
+                std::vector<ChunkState> chunks(chunks_count);
+                parallel_for_chunks(this->size(), chunks_count, [&](const size_type chunk, const size_type first, const size_type last) {
+                    chunks[chunk] = expand(first, last, 0, nullptr);
+                });
+
+                // fixes up the chunks states for their actual starting columns, then gets the offsets of the chunks in the result
+                std::vector<size_type> columns(chunks_count);
+                std::vector<size_type> offsets(chunks_count + 1);
+                size_type column{ 0 };
+                for (size_type chunk = 0; chunk < chunks_count; ++chunk) {
+                    ChunkState& state{ chunks[chunk] };
+                    columns[chunk] = column;
+                    const size_type head_column{ (column + state.head_size) % tabsize_ };
+                    if (state.head_ends_with_tab)
+                        state.out_size = state.out_size - (tabsize_ - state.head_size % tabsize_) + (tabsize_ - head_column);
+                    else if (state.head_only)
+                        state.end_column = head_column;     // i.e. no tab and no line break in this chunk
+                    offsets[chunk + 1] = offsets[chunk] + state.out_size;
+                    column = state.end_column;
+                }
+
+                const size_type res_size{ offsets[chunks_count] };
+                const auto fill = [&](CharT* const out) {
+                    parallel_for_chunks(this->size(), chunks_count, [&](const size_type chunk, const size_type first, const size_type last) {
+                        expand(first, last, columns[chunk], out + offsets[chunk]);
+                    });
+                };
+
+                // filling starts threads and may throw, so it cannot run within resize_and_overwrite()
+                CppStringT res{};
+                res.resize(res_size);
+                fill(res.data());
+                return res;
+            }
+        }
+#endif
+
+
+        //---   expand_tabs_inplace()   ---------------------------
+        /** \brief In-place replaces all tab characters of the string by one or more spaces, as expand_tabs() does. Returns a reference to string.
+        *
+        * The exact size of the result is computed first. The string is then
+        * resized,  which allocates no memory when its capacity is already
+        * large enough, and its characters get moved from the last one to the
+        * first one, the spaces of the tabs filling the room that gets freed.
+        */
+        CppStringT& expand_tabs_inplace(const size_type tabsize = 8)
+        {
+            const size_type tabsize_{ tabsize == 0 ? 1 : tabsize };
+            size_type tabs_count{ 0 };
+            const size_type prev_size{ this->size() };
+            const size_type res_size{ _expanded_tabs_size(tabsize_, tabs_count) };
+            if (tabs_count == 0) [[unlikely]]
+                return *this;
+
+            // the characters are moved backwards, runs being copied from the run after the last tab or line break back to the first run
+            const auto expand = [tabsize_, prev_size, res_size](CharT* const chars) noexcept {
+                CharT* out{ chars + res_size };
+                const CharT* run_last{ chars + prev_size };
+                const CharT* run_first{ _rfind_run_start(chars, run_last) };
+                for (;;) {
+                    const size_type run_size{ size_type(run_last - run_first) };
+                    out -= run_size;
+                    TraitsT::move(out, run_first, run_size);
+                    if (run_first == chars)
+                        break;
+
+                    const CharT* const stop{ run_first - 1 };
+                    run_last = stop;
+                    run_first = _rfind_run_start(chars, stop);
+                    if (*stop == value_type('\t')) {
+                        const size_type spaces_count{ tabsize_ - size_type(stop - run_first) % tabsize_ };
+                        out -= spaces_count;
+                        TraitsT::assign(out, spaces_count, value_type(' '));
+                    }
+                    else
+                        *--out = *stop;
+                }
+            };
+
+#if defined(__cpp_lib_string_resize_and_overwrite)
+            this->resize_and_overwrite(res_size, [&expand, res_size](CharT* chars, std::size_t) noexcept {
+                expand(chars);
+                return res_size;
+            });
+#else
+            this->resize(res_size);
+            expand(this->data());
+#endif
+            return *this;
+        }
 
-            std::size_t current_pos{ 0 };
+
+        //---   expand_tabs_into()   ------------------------------
+        /** \brief Outputs the string with its tab characters expanded via output iterator out, as expand_tabs() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt expand_tabs_into(OutputIt out, const size_type tabsize = 8) const
+        {
+            const size_type tabsize_{ tabsize == 0 ? 1 : tabsize };
+            size_type current_pos{ 0 };     // current column
             for (const value_type ch : *this) {
                 if (ch == value_type('\t')) [[unlikely]] {
-                    do {
-                        ret += value_type(' ');
-                        current_pos++;
-                    } while (current_pos % tabsize_ != 0);
+                    const size_type spaces_count{ tabsize_ - current_pos % tabsize_ };
+                    out = std::fill_n(out, spaces_count, value_type(' '));
+                    current_pos += spaces_count;
+                    continue;
                 }
                 else if (ch == value_type('\n') || ch == value_type('\r')) [[unlikely]] {
-                    ret += ch;
                     current_pos = 0;
                 }
                 else [[likely]] {
-                    ret += ch;
                     current_pos++;
                 }
+                *out++ = ch;
             }
+            return out;
+        }
 
-            return ret;
+        /** \brief Writes the string with its tab characters expanded into the caller-provided span dest, as expand_tabs() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type expand_tabs_into(std::span<CharT> dest, const size_type tabsize = 8) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->expand_tabs_into(output.begin(), tabsize);
+            return output.count();
         }
 
 
@@ -673,6 +1298,57 @@ namespace pcs // i.e. "pythonic c++ strings"
                 return find_n(sub, start, end_ - start + 1);
         }
 
+        /** \brief Returns the lowest index in the string where character ch is found within the slice str[start:end], or -1 (i.e. 'npos') if ch is not found. */
+        [[nodiscard]]
+        inline size_type find(const value_type ch, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            if (start >= this->size()) [[unlikely]]
+                return CppStringT::npos;
+
+            const size_type last{ (end >= this->size()) ? this->size() : end + 1 };
+            if (start >= last) [[unlikely]]
+                return CppStringT::npos;
+
+            const CharT* const found{ TraitsT::find(this->data() + start, last - start, ch) };
+            return (found == nullptr) ? CppStringT::npos : size_type(found - this->data());
+        }
+
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns the lowest index in the whole string where substring sub is found, or -1 (i.e. 'npos') if sub is not found, searching on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings, which get cut into chunks searched on
+        * threads_count threads (0 stands for the count of hardware threads),
+        * chunks overlapping by sub.size() - 1 characters.  Chunks are searched
+        * block after block, and a thread stops as soon as sub has been found
+        * at a lower index than its current block. Other policies run method
+        * find(sub) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        size_type find(ExecutionPolicyT&&, const CppStringT& sub, const size_type threads_count = 0) const
+        {
+            if constexpr (is_parallel_policy_v<ExecutionPolicyT>) {
+                if (!sub.empty()) [[likely]]
+                    return _parallel_find(sub, threads_count, false);
+            }
+            return find(sub);
+        }
+#endif
+
+
+        //---   find_any()   --------------------------------------
+        /** \brief Returns the lowest index in the string where any character of set chars is found within the slice str[start:end], or -1 (i.e. 'npos') if none is found. */
+        [[nodiscard]]
+        size_type find_any(const CharSetT<CharT>& chars, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            const size_type last{ (end >= this->size()) ? this->size() : end + 1 };
+            for (size_type index = start; index < last; ++index)
+                if (chars.contains((*this)[index])) [[unlikely]]
+                    return index;
+            return CppStringT::npos;
+        }
+
 
         //---   find_n()   ----------------------------------------
         /** \brief Returns the lowest index in the string where substring sub is found within the slice str[start:start+count-1], or -1 (i.e. 'npos') if sub is not found.
@@ -723,36 +1399,235 @@ namespace pcs // i.e. "pythonic c++ strings"
 
 
         //---   format()   ----------------------------------------
-        /** \brief Formats this string according to c++20 std::format() specification. Returns this string. */
-        template<typename T, class... ArgsT>
+        /** \brief Formats this string according to c++20 std::format() specification. Returns this string.
+        *
+        * The text is formatted into a buffer that is owned by the calling
+        * thread and that keeps its capacity from call to call,  and is then
+        * copied into this string, which keeps its capacity too. So, once
+        * both have grown enough, formatting allocates no memory. Arguments
+        * may reference this string.
+        */
+        template<class... ArgsT>
+            requires std::is_same_v<CharT, char> || std::is_same_v<CharT, wchar_t>
         inline CppStringT& format(
-            const std::basic_format_string<T, std::type_identity_t<ArgsT>...> frmt,
+            const std::basic_format_string<CharT, std::type_identity_t<ArgsT>...> frmt,
             ArgsT&&... args
         )
         {
+            _with_format_buffer<CharT>([&](std::basic_string<CharT>& buffer) {
+                std::vformat_to(std::back_inserter(buffer), frmt.get(), _make_format_args(args...));
+                this->assign(buffer.data(), buffer.size());
+            });
             return *this;
         }
 
+        /** \brief Formats this string according to c++20 std::format() specification, from a UTF-8 char format string. Returns this string.
+        *
+        * This is the version for char8_t, char16_t and char32_t strings,
+        * which std::format() does not support. The text is formatted  as
+        * UTF-8 chars and then transcoded into the characters of this string.
+        * Invalid UTF-8 sequences get transcoded as U+FFFD, for char8_t
+        * strings as well.
+        */
         template<class... ArgsT>
-        inline CppStringT& format(      //!< specialzation for char's
-            const std::basic_format_string<char , std::type_identity_t<ArgsT>... > frmt,
-            ArgsT&&... args
-        )
+            requires (!std::is_same_v<CharT, char> && !std::is_same_v<CharT, wchar_t>)
+        inline CppStringT& format(const std::format_string<ArgsT...> frmt, ArgsT&&... args)
         {
-            return *this = std::vformat(frmt.get(), std::make_format_args(args...));
+            _with_format_buffer<char>([&](std::string& buffer) {
+                std::vformat_to(std::back_inserter(buffer), frmt.get(), std::make_format_args(args...));
+                this->clear();
+                _append_utf8(*this, buffer);
+            });
+            return *this;
         }
 
+
+        //---   format_append()   ---------------------------------
+        /** \brief Appends to this string the text formatted according to c++20 std::format() specification. Returns this string.
+        *
+        * The text is formatted directly at the end of this string, which
+        * grows as needed. Once it has grown enough, e.g. when it gets reused
+        * for successive lines of a log after having been cleared, formatting
+        * allocates no memory.  Arguments must not reference this string.
+        */
         template<class... ArgsT>
-        inline CppStringT& format(      //!< specialzation for wchar_t's
-            const std::basic_format_string<wchar_t, std::type_identity_t<ArgsT>... > frmt,
+            requires std::is_same_v<CharT, char> || std::is_same_v<CharT, wchar_t>
+        inline CppStringT& format_append(
+            const std::basic_format_string<CharT, std::type_identity_t<ArgsT>...> frmt,
             ArgsT&&... args
         )
         {
-            return *this = std::vformat(frmt.get(), std::make_wformat_args(args...));
+            std::vformat_to(std::back_inserter(static_cast<MyBaseClass&>(*this)), frmt.get(), _make_format_args(args...));
+            return *this;
         }
 
-
-        //---   index()   -----------------------------------------
+        /** \brief Appends to this string the text formatted according to c++20 std::format() specification, from a UTF-8 char format string. Returns this string.
+        *
+        * This is the version for char8_t, char16_t and char32_t strings, as
+        * for method format(). Arguments may reference this string.
+        */
+        template<class... ArgsT>
+            requires (!std::is_same_v<CharT, char> && !std::is_same_v<CharT, wchar_t>)
+        inline CppStringT& format_append(const std::format_string<ArgsT...> frmt, ArgsT&&... args)
+        {
+            _with_format_buffer<char>([&](std::string& buffer) {
+                std::vformat_to(std::back_inserter(buffer), frmt.get(), std::make_format_args(args...));
+                _append_utf8(*this, buffer);
+            });
+            return *this;
+        }
+
+
+        //---   from_number()   -----------------------------------
+        /** \brief Returns the string of the integer value written in base, as Python str() and format() do. Digits above 9 are lowercase letters.
+        *
+        * Raises ValueException when base is not from 2 to 36.
+        */
+        template<class IntT>
+            requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+        [[nodiscard]]
+        static CppStringT from_number(const IntT value, const int base = 10)
+        {
+            if (base < 2 || base > 36) [[unlikely]]
+                throw ValueException(std::format("base must be >= 2 and <= 36, not {}.", base));
+
+            char chars[std::numeric_limits<IntT>::digits + 2];
+            const auto [last, ec] { std::to_chars(chars, chars + sizeof(chars), value, base) };
+            return CppStringT(chars, last);
+        }
+
+        /** \brief Returns the shortest string that reads back as the floating-point value, as Python repr() does.
+        *
+        * Values with decimal exponents from -4 up to 15 are written in fixed
+        * notation and get ".0" appended when they are integral,  the other
+        * ones are written in scientific notation with at least two exponent
+        * digits, e.g. "0.0001", "1.5", "100.0", "1e+16" or "1.5e-05".
+        * Infinite and NaN values are written "inf", "-inf" and "nan".
+        */
+        template<class FloatT>
+            requires std::floating_point<FloatT>
+        [[nodiscard]]
+        static CppStringT from_number(const FloatT value)
+        {
+            if (!std::isfinite(value)) [[unlikely]] {
+                const std::string_view name{ std::isnan(value) ? "nan" : value < 0 ? "-inf" : "inf" };
+                return CppStringT(name.begin(), name.end());
+            }
+
+            // shortest round-trip digits, e.g. "-1.2345e+15"
+            char sci[64];
+            char* const sci_last{ std::to_chars(sci, sci + sizeof(sci), value, std::chars_format::scientific).ptr };
+            const char* const exp_pos{ std::find(sci, sci_last, 'e') };
+            const bool negative{ sci[0] == '-' };
+            int exponent{ 0 };
+            std::from_chars(exp_pos + (exp_pos[1] == '+' ? 2 : 1), sci_last, exponent);
+
+            char digits[std::numeric_limits<FloatT>::max_digits10 + 1];
+            int digits_count{ 0 };
+            for (const char* p = sci + negative; p != exp_pos; ++p)
+                if (*p != '.')
+                    digits[digits_count++] = *p;
+
+            char chars[64];
+            char* out{ chars };
+            if (negative)
+                *out++ = '-';
+            if (-4 <= exponent && exponent < 16) {
+                if (exponent < 0) {
+                    out = std::fill_n(std::copy_n("0.", 2, out), -exponent - 1, '0');
+                    out = std::copy_n(digits, digits_count, out);
+                }
+                else {
+                    const int int_count{ exponent + 1 };
+                    out = std::copy_n(digits, std::min(int_count, digits_count), out);
+                    out = std::fill_n(out, std::max(int_count - digits_count, 0), '0');
+                    *out++ = '.';
+                    if (digits_count > int_count)
+                        out = std::copy(digits + int_count, digits + digits_count, out);
+                    else
+                        *out++ = '0';
+                }
+            }
+            else {
+                *out++ = digits[0];
+                if (digits_count > 1) {
+                    *out++ = '.';
+                    out = std::copy(digits + 1, digits + digits_count, out);
+                }
+                *out++ = 'e';
+                *out++ = exponent < 0 ? '-' : '+';
+                if (-10 < exponent && exponent < 10)
+                    *out++ = '0';
+                out = std::to_chars(out, chars + sizeof(chars), exponent < 0 ? -exponent : exponent).ptr;
+            }
+            return CppStringT(chars, out);
+        }
+
+        /** \brief Returns the string of the floating-point value written with format fmt and precision, as std::to_chars() does. */
+        template<class FloatT>
+            requires std::floating_point<FloatT>
+        [[nodiscard]]
+        static CppStringT from_number(const FloatT value, const std::chars_format fmt, const int precision)
+        {
+            char chars[128];
+            const auto [last, ec] { std::to_chars(chars, chars + sizeof(chars), value, fmt, precision) };
+            if (ec == std::errc{}) [[likely]]
+                return CppStringT(chars, last);
+
+            // very large fixed values or very large precisions
+            std::string buffer(std::size_t(std::numeric_limits<FloatT>::max_exponent10 + precision + 16), '\0');
+            return CppStringT(buffer.data(), std::to_chars(buffer.data(), buffer.data() + buffer.size(), value, fmt, precision).ptr);
+        }
+
+
+        //---   icount()   ----------------------------------------
+        /** \brief Returns the number of non-overlapping occurrences of substring sub in the range [start, end], ignoring case.
+        *
+        * Characters get compared via their case folded forms, see fold_case(),
+        * on the fly, without any copy of this string or of sub.
+        */
+        [[nodiscard]]
+        size_type icount(const std::basic_string_view<CharT, TraitsT> sub, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            const size_type last{ _range_last(end) };
+            if (start > last) [[unlikely]]
+                return 0;
+            if (sub.empty()) [[unlikely]]
+                return last - start + 1;
+
+            size_type n{ 0 };
+            for (size_type pos = start; (pos = _ifind(sub, pos, last)) != CppStringT::npos; pos += sub.size())
+                ++n;
+            return n;
+        }
+
+
+        //---   iendswith()   -------------------------------------
+        /** \brief Returns true if the range [start, end] of the string ends with the specified suffix ignoring case, or false otherwise. */
+        [[nodiscard]]
+        bool iendswith(const std::basic_string_view<CharT, TraitsT> suffix, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            const size_type last{ _range_last(end) };
+            return start <= last && last - start >= suffix.size() &&
+                   IEqualT<CharT, TraitsT>::equal_n(this->data() + last - suffix.size(), suffix.data(), suffix.size());
+        }
+
+
+        //---   ifind()   -----------------------------------------
+        /** \brief Returns the lowest index in the string where substring sub is found within the range [start, end] ignoring case, or -1 (i.e. 'npos') if sub is not found.
+        *
+        * Characters get compared via their case folded forms, see fold_case(),
+        * on the fly, without any copy of this string or of sub.
+        */
+        [[nodiscard]]
+        size_type ifind(const std::basic_string_view<CharT, TraitsT> sub, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            const size_type last{ _range_last(end) };
+            return (start > last) ? CppStringT::npos : _ifind(sub, start, last);
+        }
+
+
+        //---   index()   -----------------------------------------
         /** \brief Like find(const CppStringT&), but raises NotFoundException when the substring sub is not found.
         *
         * \see index_n(), rindex() and rindex_n().
@@ -950,6 +1825,17 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   istartswith()   -----------------------------------
+        /** \brief Returns true if the range [start, end] of the string starts with the specified prefix ignoring case, or false otherwise. */
+        [[nodiscard]]
+        bool istartswith(const std::basic_string_view<CharT, TraitsT> prefix, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            const size_type last{ _range_last(end) };
+            return start <= last && last - start >= prefix.size() &&
+                   IEqualT<CharT, TraitsT>::equal_n(this->data() + start, prefix.data(), prefix.size());
+        }
+
+
         //---   istitle()   ---------------------------------------
         /** \brief Returns true if the string is a titlecased string and there is at least one character, or false otherwise.
         *
@@ -999,14 +1885,8 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         CppStringT join(const std::array<CppStringT, N>& strs) const noexcept
         {
-            if (strs.empty()) [[unlikely]]
-                return CppStringT();
-
-            auto str_it = strs.cbegin();
-            CppStringT res{ *str_it++ };
-            while (str_it != strs.cend()) [[likely]]
-                res += *this + *str_it++;
-            return res;
+            CppStringBuilderT<CharT, TraitsT, AllocatorT> builder{};
+            return builder.append_join(*this, strs).str();
         }
 
         /** \brief Returns a string which is the concatenation of the strings in the vector parameter.
@@ -1016,14 +1896,8 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         CppStringT join(const std::vector<CppStringT>& strs) const noexcept
         {
-            if (strs.empty()) [[unlikely]]
-                return CppStringT();
-
-            auto str_it = strs.cbegin();
-            CppStringT res{ *str_it++ };
-            while (str_it != strs.cend()) [[likely]]
-                res += *this + *str_it++;
-            return res;
+            CppStringBuilderT<CharT, TraitsT, AllocatorT> builder{};
+            return builder.append_join(*this, strs).str();
         }
 
         /** \brief Returns a string which is the concatenation of the strings in the parameters list.
@@ -1035,7 +1909,9 @@ namespace pcs // i.e. "pythonic c++ strings"
         inline CppStringT join(const CppStringT& first, const NextCppStringsT&... others) const noexcept
             requires (sizeof...(others) > 0)
         {
-            return first + *this + this->join(others...);
+            using ViewTermT = ConcatViewT<CharT, TraitsT>;
+            const auto joined{ (ViewTermT{ first } + ... + (ViewTermT{ *this } + others)) };
+            return joined.template str<AllocatorT>();
         }
 
         /** \brief Single parameter signature. Returns a copy of this parameter. */
@@ -1056,16 +1932,43 @@ namespace pcs // i.e. "pythonic c++ strings"
         //---   ljust()   -----------------------------------------
         /** \brief Returns the string left justified in a string of length width.
         *
-        * Padding is done using the specified fillchar (default is an ASCII space).
-        * The original string is returned if width is less than or equal to len(s).
+        * Padding is done on the right using the specified fillchar (default
+        * is an ASCII space),  with one single allocation  of  the resulting
+        * string. The original string is returned if width is less than or
+        * equal to len(s).
         */
         [[nodiscard]]
         inline CppStringT ljust(const size_type width, const value_type fillch = value_type(' ')) const noexcept
         {
             if (this->size() >= width) [[unlikely]]
                 return *this;
-            else [[likely]]
-                return CppStringT(width - this->size(), fillch) + *this;
+
+            return *this + FillRunT<CharT, TraitsT>{ width - this->size(), fillch };
+        }
+
+
+        //---   ljust_into()   ------------------------------------
+        /** \brief Outputs the string left justified in a string of length width via output iterator out, as ljust() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt ljust_into(OutputIt out, const size_type width, const value_type fillch = value_type(' ')) const
+        {
+            out = std::copy(this->cbegin(), this->cend(), out);
+            if (this->size() < width) [[likely]]
+                out = std::fill_n(out, width - this->size(), fillch);
+            return out;
+        }
+
+        /** \brief Writes the string left justified in a string of length width into the caller-provided span dest, as ljust() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type ljust_into(std::span<CharT> dest, const size_type width, const value_type fillch = value_type(' ')) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->ljust_into(output.begin(), width, fillch);
+            return output.count();
         }
 
 
@@ -1086,6 +1989,25 @@ namespace pcs // i.e. "pythonic c++ strings"
             return *this;
         }
 
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief In-place replaces all characters of the string with their lowercase conversion, converting on several threads when policy is std::execution::par or par_unseq. Returns a reference to string.
+        *
+        * Meant for very large strings, cut into chunks converted on
+        * threads_count threads (0 stands for the count of hardware threads).
+        * Other policies run method lower() on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        CppStringT& lower(ExecutionPolicyT&&, const size_type threads_count = 0)
+        {
+            if constexpr (is_parallel_policy_v<ExecutionPolicyT>)
+                _parallel_transform(this->data(), [](const value_type ch) { return CppStringT::lower(ch); }, threads_count);
+            else
+                lower();
+            return *this;
+        }
+#endif
+
         /** \brief Returns lowercase conversion of the character.
         *
         * Notice: uses the currently set std::locale, which is the "C" one
@@ -1098,6 +2020,32 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   lower_into()   ------------------------------------
+        /** \brief Outputs the lowercase conversion of the string via output iterator out. Returns the iterator past the last output character.
+        *
+        * The string itself remains unchanged. Notice: uses the currently set
+        * std::locale, as method lower() does.
+        */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt lower_into(OutputIt out) const
+        {
+            return std::transform(this->cbegin(), this->cend(), out, [](const value_type ch) { return CppStringT::lower(ch); });
+        }
+
+        /** \brief Writes the lowercase conversion of the string into the caller-provided span dest.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type lower_into(std::span<CharT> dest) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->lower_into(output.begin());
+            return output.count();
+        }
+
+
         //---   lstrip()   ----------------------------------------
         /** \brief Returns a copy of the string with leading characters removed.
         *
@@ -1109,10 +2057,28 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         inline CppStringT lstrip(const CppStringT& removedchars) const noexcept
         {
-            for (auto it = this->cbegin(); it != this->cend(); ++it) [[likely]]
-                if (std::none_of(removedchars.cbegin(), removedchars.cend(), [it](const value_type ch) { return *it == ch; })) [[likely]]
-                    return CppStringT(it, this->cend());
-            return CppStringT();
+            return this->lstrip(CharSetT<CharT>(removedchars));
+        }
+
+        /** \brief Returns a copy of the string with its leading characters that are in set removedchars removed.
+        *
+        * This is a template, constrained to sets of characters, so that
+        * braced lists of characters select lstrip(const CppStringT&).
+        */
+        template<class SetT>
+            requires std::same_as<SetT, CharSetT<CharT>>
+        [[nodiscard]]
+        inline CppStringT lstrip(const SetT& removedchars) const noexcept
+        {
+            return CppStringT(std::find_if_not(this->cbegin(), this->cend(), std::cref(removedchars)), this->cend());
+        }
+
+        /** \brief Returns a copy of the string with leading characters ch removed. */
+        [[nodiscard]]
+        inline CppStringT lstrip(const value_type ch) const noexcept
+        {
+            const size_type first{ this->find_first_not_of(ch) };
+            return (first == CppStringT::npos) ? CppStringT() : CppStringT(this->data() + first, this->size() - first);
         }
 
         /** \brief Returns a copy of the string with leading whitespaces removed. */
@@ -1188,8 +2154,9 @@ namespace pcs // i.e. "pythonic c++ strings"
             if (count <= 0) [[unlikely]]
                 return CppStringT();
 
-            CppStringT res(*this);
-            while (--count) [[likely]]
+            CppStringT res{};
+            res.reserve(this->size() * size_type(count));
+            while (count--) [[likely]]
                 res += *this;
             return res;
         }
@@ -1216,6 +2183,51 @@ namespace pcs // i.e. "pythonic c++ strings"
             }
         }
 
+        /** \brief Splits the string at the first occurrence of character sep, and returns a 3-items vector containing the part before the separator, the separator itself, and the part after the separator.
+        *
+        * If the separator is not  found,  returns  a  3-items  vector
+        * containing the string itself, followed by two empty strings.
+        */
+        [[nodiscard]]
+        std::vector<CppStringT> partition(const value_type sep) const noexcept
+        {
+            const size_type sep_index{ this->find(sep) };
+            if (sep_index == CppStringT::npos) [[unlikely]]
+                return std::vector<CppStringT>({ *this, CppStringT(), CppStringT() });
+            else [[likely]]
+                return std::vector<CppStringT>({ CppStringT(this->data(), sep_index), CppStringT(sep), CppStringT(this->data() + sep_index + 1, this->size() - sep_index - 1) });
+        }
+
+
+        //---   partition_interned()   ----------------------------
+        /** \brief Same as partition() but returns a 3-items vector of interned strings.
+        *
+        * The three parts are interned into the global pool of interned strings
+        * directly from the content of this string, without creating any  tem-
+        * porary string. \see function pcs::intern() and class CppInternedT.
+        */
+        [[nodiscard]]
+        std::vector<CppInternedT<CharT, TraitsT>> partition_interned(const CppStringT& sep) const
+        {
+            using view_type = std::basic_string_view<CharT, TraitsT>;
+            auto& pool = InternPoolT<CharT, TraitsT>::global();
+
+            const view_type this_view(*this);
+            const size_type sep_index = MyBaseClass::find(sep);
+            if (sep_index == CppStringT::npos) {
+                const CppInternedT<CharT, TraitsT> empty{};
+                return std::vector<CppInternedT<CharT, TraitsT>>({ pool.intern(this_view), empty, empty });
+            }
+            else {
+                const size_type third_index = sep_index + sep.size();
+                return std::vector<CppInternedT<CharT, TraitsT>>({
+                    pool.intern(this_view.substr(0, sep_index)),
+                    pool.intern(view_type(sep)),
+                    pool.intern(this_view.substr(third_index))
+                });
+            }
+        }
+
 
         //---   removeprefix()   ----------------------------------
         /** \brief If the string starts with the prefix string, returns a new string with the prefix removed. Otherwise, returns a copy of the original string. */
@@ -1246,28 +2258,169 @@ namespace pcs // i.e. "pythonic c++ strings"
 
 
         //---   replace()   ---------------------------------------
-        /** \brief Returns a copy of the string with first count occurrences of substring 'old' replaced by 'new_'. */
+        /** \brief Returns a copy of the string with first count occurrences of substring 'old' replaced by 'new_'.
+        *
+        * Occurrences are searched for from left to right and do not overlap.
+        */
         [[nodiscard]]
         CppStringT replace(const CppStringT& old, const CppStringT& new_, size_type count = -1) const noexcept
         {
             if (old == new_ || old.empty()) [[unlikely]]
                 return *this;
 
-            CppStringT res{};
+            using view_type = std::basic_string_view<CharT, TraitsT>;
+            const view_type this_view(*this);
+            CppStringBuilderT<CharT, TraitsT, AllocatorT> builder{};
             size_type prev_index = 0;
             size_type current_index = 0;
-            while (count > 0 && (current_index = this->find(old, prev_index)) != CppStringT::npos) {
-                res += this->substr(prev_index, current_index - prev_index) + new_;
-                prev_index = current_index + 1;
+            while (count > 0 && (current_index = this_view.find(old, prev_index)) != CppStringT::npos) {
+                builder.append(this_view.substr(prev_index, current_index - prev_index)).append(new_);
+                prev_index = current_index + old.size();
                 --count;
             }
+            builder.append(this_view.substr(prev_index));
 
-            if (prev_index < this->size()) [[likely]]
-                res += this->substr(prev_index, this->size() - prev_index);
+            return builder.str();
+        }
+
+        /** \brief Returns a copy of the string with first count occurrences of character 'old' replaced by character 'new_'.
+        *
+        * When all occurrences get replaced, the copy is processed with one
+        * single branch-free pass, which compilers vectorize.
+        */
+        [[nodiscard]]
+        CppStringT replace(const value_type old, const value_type new_, size_type count = -1) const noexcept
+        {
+            CppStringT res{ *this };
+            if (old == new_ || count == 0) [[unlikely]]
+                return res;
 
+            CharT* chars{ res.data() };
+            CharT* const last{ chars + res.size() };
+            if (count >= res.size()) [[likely]] {
+                std::transform(chars, last, chars, [old, new_](const value_type ch) { return ch == old ? new_ : ch; });
+            }
+            else [[unlikely]] {
+                while (count > 0 && (chars = const_cast<CharT*>(TraitsT::find(chars, last - chars, old))) != nullptr) {
+                    *chars++ = new_;
+                    --count;
+                }
+            }
             return res;
         }
 
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns a copy of the string with first count occurrences of substring 'old' replaced by 'new_', replacing on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings.  Occurrences of old are searched on
+        * threads_count threads (0 stands for the count of hardware threads)
+        * and are fixed up where they straddle chunks of the string,  so that
+        * they are exactly the ones that replace(old, new_, count) replaces.
+        * Their indexes in the resulting string are then known,  which gets
+        * allocated once and filled in parallel, each thread copying one
+        * chunk of this string.  Other policies run method replace(old, new_,
+        * count) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        CppStringT replace(ExecutionPolicyT&&, const CppStringT& old, const CppStringT& new_, const size_type count = -1, const size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                return replace(old, new_, count);
+            else {
+                if (old == new_ || old.empty()) [[unlikely]]
+                    return *this;
+
+                std::vector<size_type> olds_pos{ _parallel_find_all(old, threads_count) };
+                if (olds_pos.size() > count) [[unlikely]]
+                    olds_pos.resize(count);
+
+                const size_type old_size{ old.size() };
+                const size_type new_size{ new_.size() };
+                const size_type res_size{ this->size() - olds_pos.size() * old_size + olds_pos.size() * new_size };
+
+                // the index-th occurrence of old, as well as the characters that follow it, get shifted by index * (new_size - old_size),
+                // which wraps around when new_ is shorter than old: offsets are summed before being added to pointers
+                const auto fill = [&](CharT* const out) {
+                    parallel_for_chunks(this->size(), parallel_chunks_count(this->size(), threads_count, PARALLEL_MIN_CHARS), [&](const size_type, size_type first, const size_type last) {
+                        size_type index{ size_type(std::lower_bound(olds_pos.cbegin(), olds_pos.cend(), first) - olds_pos.cbegin()) };
+                        if (index > 0 && olds_pos[index - 1] + old_size > first)
+                            first = olds_pos[index - 1] + old_size;     // this chunk starts within an occurrence of the previous chunk
+                        while (first < last) {
+                            const size_type old_pos{ index < olds_pos.size() ? olds_pos[index] : this->size() };
+                            const size_type shift{ index * new_size - index * old_size };
+                            TraitsT::copy(out + (first + shift), this->data() + first, std::min(old_pos, last) - first);
+                            if (old_pos >= last)
+                                break;
+                            TraitsT::copy(out + (old_pos + shift), new_.data(), new_size);
+                            first = old_pos + old_size;
+                            ++index;
+                        }
+                    });
+                };
+
+                // filling starts threads and may throw, so it cannot run within resize_and_overwrite()
+                CppStringT res{};
+                res.resize(res_size);
+                fill(res.data());
+                return res;
+            }
+        }
+#endif
+
+
+        //---   replace_many()   ----------------------------------
+        /** \brief Returns a copy of the string with all the substrings of a set of substitutions replaced in one single pass.
+        *
+        * The set may be passed as a braced list of pairs {old, new_}, e.g.
+        * s.replace_many({ {"&", "&amp;"}, {"<", "&lt;"} }),  or  as a
+        * compiled ReplacerT, which is the efficient way to go when the same
+        * substitutions get applied to many strings.  At each position, the
+        * longest matching old substring gets replaced (leftmost-longest
+        * semantics). Replacements are not scanned again.
+        */
+        [[nodiscard]]
+        inline CppStringT replace_many(const ReplacerT<CharT, TraitsT>& replacer) const
+        {
+            return replacer.template replace<AllocatorT>(*this);
+        }
+
+
+        //---   replace_into()   ----------------------------------
+        /** \brief Outputs the string with its first count occurrences of substring 'old' replaced by 'new_' via output iterator out, as replace() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt replace_into(OutputIt out, const CppStringT& old, const CppStringT& new_, size_type count = -1) const
+        {
+            using view_type = std::basic_string_view<CharT, TraitsT>;
+            const view_type this_view(*this);
+            if (old.empty()) [[unlikely]]
+                return std::copy(this_view.cbegin(), this_view.cend(), out);
+
+            size_type prev_index = 0;
+            size_type current_index = 0;
+            while (count > 0 && (current_index = this_view.find(old, prev_index)) != CppStringT::npos) {
+                out = std::copy(this_view.cbegin() + prev_index, this_view.cbegin() + current_index, out);
+                out = std::copy(new_.cbegin(), new_.cend(), out);
+                prev_index = current_index + old.size();
+                --count;
+            }
+            return std::copy(this_view.cbegin() + prev_index, this_view.cend(), out);
+        }
+
+        /** \brief Writes the string with its first count occurrences of substring 'old' replaced by 'new_' into the caller-provided span dest, as replace() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type replace_into(std::span<CharT> dest, const CppStringT& old, const CppStringT& new_, size_type count = -1) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->replace_into(output.begin(), old, new_, count);
+            return output.count();
+        }
+
 
         //---   rfind()   -----------------------------------------
         /** \brief Returns the highest index in the string where substring sub is found within the slice str[start:end], or -1 (i.e. 'npos') if sub is not found.
@@ -1340,6 +2493,19 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   rfind_any()   -------------------------------------
+        /** \brief Returns the highest index in the string where any character of set chars is found within the slice str[start:end], or -1 (i.e. 'npos') if none is found. */
+        [[nodiscard]]
+        size_type rfind_any(const CharSetT<CharT>& chars, const size_type start = 0, const size_type end = -1) const noexcept
+        {
+            const size_type last{ (end >= this->size()) ? this->size() : end + 1 };
+            for (size_type index = last; index > start; --index)
+                if (chars.contains((*this)[index - 1])) [[unlikely]]
+                    return index - 1;
+            return CppStringT::npos;
+        }
+
+
         //---   rfind_n()   ---------------------------------------
         /** \brief Returns the highest index in the string where substring sub is found within the slice str[start:start+count-1], or -1 (i.e. 'npos') if sub is not found.
         *
@@ -1439,16 +2605,42 @@ namespace pcs // i.e. "pythonic c++ strings"
         //---   rjust()   -----------------------------------------
         /** \brief Returns the string right justified in a string of length width.
         *
-        * Padding is done using the specified fillchar (default is an ASCII space).
-        * The original string is returned if width is less than or equal to len(s).
+        * Padding is done on the left using the specified fillchar (default
+        * is an ASCII space),  with one single allocation  of  the resulting
+        * string. The original string is returned if width is less than or
+        * equal to len(s).
         */
         [[nodiscard]]
         inline CppStringT rjust(const size_type width, const value_type fillch = value_type(' ')) const noexcept
         {
             if (this->size() >= width) [[unlikely]]
                 return *this;
-            else [[likely]]
-                return *this + CppStringT(width - this->size(), fillch);
+
+            return FillRunT<CharT, TraitsT>{ width - this->size(), fillch } + *this;
+        }
+
+
+        //---   rjust_into()   ------------------------------------
+        /** \brief Outputs the string right justified in a string of length width via output iterator out, as rjust() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt rjust_into(OutputIt out, const size_type width, const value_type fillch = value_type(' ')) const
+        {
+            if (this->size() < width) [[likely]]
+                out = std::fill_n(out, width - this->size(), fillch);
+            return std::copy(this->cbegin(), this->cend(), out);
+        }
+
+        /** \brief Writes the string right justified in a string of length width into the caller-provided span dest, as rjust() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type rjust_into(std::span<CharT> dest, const size_type width, const value_type fillch = value_type(' ')) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->rjust_into(output.begin(), width, fillch);
+            return output.count();
         }
 
 
@@ -1500,43 +2692,53 @@ namespace pcs // i.e. "pythonic c++ strings"
             return rsplit(CppStringT(value_type(' ')), maxsplit);
         }
 
-        /** \brief Returns a vector of the words in the string, using sep as the delimiter string. At most maxsplit splits are done, the rightmost ones. */
+        /** \brief Returns a vector of the words in the string, using sep as the delimiter string. At most maxsplit splits are done, the rightmost ones.
+        *
+        * The string is scanned backwards once. Each word gets copied once,
+        * directly into the resulting vector.
+        */
         [[nodiscard]]
-        std::vector<CppStringT> rsplit(const CppStringT& sep, const size_type maxsplit) noexcept
+        std::vector<CppStringT> rsplit(const CppStringT& sep, const size_type maxsplit) const noexcept
         {
             std::vector<CppStringT> res{};
+            for (const auto word : this->rsplit_view(sep, maxsplit))
+                res.emplace_back(word.data(), word.size());
+            std::ranges::reverse(res);
+            return res;
+        }
 
-            if (maxsplit == 0) [[unlikely]] {
-                res.push_back({ *this });
-            }
-            else [[likely]] {
-                const size_type sep_size{ sep.size() };
-                std::vector<size_type> indexes{};
-                CppStringT tmp{ *this };
-                size_type count{ maxsplit };
-                size_type index{ 0 };
-
-                while ((index = tmp.rfind(sep)) != CppStringT::npos && count > 0) {
-                    indexes.insert(indexes.begin(), index);
-                    if (index == 0)
-                        break;
-                    tmp = tmp.substr(0, index);
-                    count--;
-                }
+        /** \brief Returns a vector of the words in the string, using character sep as the delimiter. At most maxsplit splits are done, the rightmost ones.
+        *
+        * This is a template, constrained to the type of characters of the
+        * string, so that integer arguments still select rsplit(maxsplit).
+        */
+        template<class ChT>
+            requires std::same_as<ChT, CharT>
+        [[nodiscard]]
+        std::vector<CppStringT> rsplit(const ChT sep, const size_type maxsplit = -1) const noexcept
+        {
+            std::vector<CppStringT> res{};
+            res.reserve(std::min(this->count(sep), maxsplit) + 1);
+            for (const auto word : this->rsplit_view(std::basic_string_view<CharT, TraitsT>(&sep, 1), maxsplit))
+                res.emplace_back(word.data(), word.size());
+            std::ranges::reverse(res);
+            return res;
+        }
 
-                if (indexes.size() == 0)
-                    res.push_back(*this);
-                else {
-                    index = 0;
-                    for (const size_type ndx : indexes) {
-                        res.push_back(this->substr(index, ndx - index));
-                        index = ndx + sep_size;
-                    }
-                }
-                res.push_back(this->substr(index, this->size() - index));
-            }
 
-            return res;
+        //---   rsplit_view()   -----------------------------------
+        /** \brief Returns a lazy view of the words in the string, from the rightmost one to the leftmost one, using sep as the delimiter string.
+        *
+        * At most maxsplit splits are done,  the rightmost ones.  No copy of
+        * the string is done: words are string views on this string,  which
+        * must then outlive the returned view, as must sep. For instance,
+        * path.rsplit_view("/") | std::views::take(2) gets the last two
+        * components of a path.
+        */
+        [[nodiscard]]
+        inline RSplitViewT<CharT, TraitsT> rsplit_view(const std::basic_string_view<CharT, TraitsT> sep, const size_type maxsplit = -1) const noexcept
+        {
+            return RSplitViewT<CharT, TraitsT>(*this, sep, maxsplit);
         }
 
 
@@ -1551,10 +2753,28 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         inline CppStringT rstrip(const CppStringT& removedchars) const noexcept
         {
-            for (auto it = this->crbegin(); it != this->crend(); ++it)
-                if (std::none_of(removedchars.cbegin(), removedchars.cend(), [it](const value_type ch) { return *it == ch; }))
-                    return CppStringT(this->cbegin(), this->cbegin() + this->size() - (it - this->crbegin()));
-            return CppStringT();
+            return this->rstrip(CharSetT<CharT>(removedchars));
+        }
+
+        /** \brief Returns a copy of the string with its trailing characters that are in set removedchars removed.
+        *
+        * This is a template, constrained to sets of characters, so that
+        * braced lists of characters select rstrip(const CppStringT&).
+        */
+        template<class SetT>
+            requires std::same_as<SetT, CharSetT<CharT>>
+        [[nodiscard]]
+        inline CppStringT rstrip(const SetT& removedchars) const noexcept
+        {
+            return CppStringT(this->cbegin(), std::find_if_not(this->crbegin(), this->crend(), std::cref(removedchars)).base());
+        }
+
+        /** \brief Returns a copy of the string with trailing characters ch removed. */
+        [[nodiscard]]
+        inline CppStringT rstrip(const value_type ch) const noexcept
+        {
+            const size_type last{ this->find_last_not_of(ch) };
+            return (last == CppStringT::npos) ? CppStringT() : CppStringT(this->data(), last + 1);
         }
 
         /** \brief Returns a copy of the string with trailing whitespaces removed. */
@@ -1568,11 +2788,78 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   sort_key()   --------------------------------------
+        /** \brief Returns the collation key of the string: keys of strings compare byte per byte as their strings collate, in a locale-free order.
+        *
+        * Keys may be compared with the operators of std::string or with
+        * std::memcmp(),  which makes them fit for sorting many strings or
+        * for storing them as indexes, e.g. in databases. As for the Unicode
+        * Collation Algorithm, keys are made of three levels of weights, a
+        * level being compared only when all the preceding ones are equal:
+        *  - primary: whitespaces, then punctuations and symbols, then digits,
+        *    then letters whatever their case and accents, and then all other
+        *    characters in code points order;
+        *  - secondary: accents, unaccented letters coming first;
+        *  - tertiary: case, lowercase letters coming first.
+        *
+        * Accented letters are known in blocks Latin-1 and Latin Extended-A,
+        * as well as letters followed by combining diacritical marks, while
+        * Greek and Cyrillic letters ignore their case at the primary level
+        * also. With natural set, runs of ASCII decimal digits collate as the
+        * numbers they are, e.g. "file2" before "file10", leading zeros being
+        * compared at the secondary level only.
+        *
+        * Strings of char are decoded as UTF-8, strings of 2-bytes characters
+        * as UTF-16 and other ones as UTF-32.
+        */
+        [[nodiscard]]
+        std::string sort_key(const bool natural = false) const
+        {
+            std::string key{};
+            std::string secondary{};
+            std::string tertiary{};
+            key.reserve(6 * this->size() + 4);
+            secondary.reserve(2 * this->size());
+            tertiary.reserve(2 * this->size());
+
+            const CharT* it{ this->data() };
+            const CharT* const last{ it + this->size() };
+            while (it != last) {
+                if (natural && *it >= CharT('0') && *it <= CharT('9')) {
+                    // numbers: marker, count of significant digits, then significant digits
+                    const CharT* const first{ it };
+                    while (it != last && *it == CharT('0'))
+                        ++it;
+                    const CharT* const significant{ it };
+                    while (it != last && *it >= CharT('0') && *it <= CharT('9'))
+                        ++it;
+                    const std::uint32_t digits_count{ std::uint32_t(std::min<std::ptrdiff_t>(it - significant, 0xffff'ffff)) };
+                    _push_weight(key, COLLATION_NUMBER);
+                    _push_weight(key, std::uint16_t(digits_count >> 16));
+                    _push_weight(key, std::uint16_t(digits_count & 0xffff));
+                    for (const CharT* digit = significant; digit != it; ++digit)
+                        key.push_back(char(*digit));
+                    _push_weight(secondary, std::uint16_t(COLLATION_COMMON + std::min<std::ptrdiff_t>(significant - first, 0xff00)));
+                    _push_weight(tertiary, COLLATION_COMMON);
+                }
+                else
+                    _append_collation_weights(_next_code_point(it, last), key, secondary, tertiary);
+            }
+
+            _push_weight(key, 0);
+            key += secondary;
+            _push_weight(key, 0);
+            key += tertiary;
+            return key;
+        }
+
+
         //---   split()   -----------------------------------------
         /** \brief Returns a vector of the words in the whole string, as seperated with whitespace strings.
         *
         * Notice: consecutive whitespaces are each regarded as a
         * single separator. So, they each separate empty strings.
+        * \see split_whitespace() for the Python behaviour.
         */
         [[nodiscard]]
         inline std::vector<CppStringT> split() noexcept
@@ -1596,10 +2883,9 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         inline std::vector<CppStringT> split(const CppStringT& sep) noexcept
         {
-            std::vector<CppStringT> res;
-            for (const auto& word : *this | std::views::split(sep))
-                res.push_back(CppStringT(word.begin(), word.end()));
-            return res;
+            SplitBufferT<CharT, TraitsT, AllocatorT> res;
+            this->split_into(res, sep);
+            return std::move(res).release();
         }
 
         /** \brief Returns a vector of the words in the string, as seperated with whitespace strings. At most maxsplit splits are done, the leftmost ones. */
@@ -1613,35 +2899,243 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         std::vector<CppStringT> split(const CppStringT& sep, const size_type maxsplit) noexcept
         {
-            std::vector<CppStringT> res{};
+            SplitBufferT<CharT, TraitsT, AllocatorT> res{};
+            this->split_into(res, sep, maxsplit);
+            return std::move(res).release();
+        }
 
-            if (maxsplit == 0) [[unlikely]] {
-                res.push_back(*this);
-            }
-            else [[likely]] {
-                const size_type sep_size{ sep.size() };
-                std::vector<size_type> indexes{};
-                size_type count{ maxsplit };
-                size_type index{ 0 };
-
-                while ((index = this->find(sep, index)) != CppStringT::npos && count > 0) {
-                    indexes.push_back(index);
-                    if (index == this->size())
-                        break;
-                    index += sep_size;
-                    count--;
+        /** \brief Returns a vector of the words in the string, using character sep as the delimiter. At most maxsplit splits are done, the leftmost ones.
+        *
+        * Separators are first counted in bulk to reserve the resulting vector,
+        * then located with traits find(), i.e. memchr() for char strings.
+        * This is a template, constrained to the type of characters of the
+        * string, so that integer arguments still select split(maxsplit).
+        */
+        template<class ChT>
+            requires std::same_as<ChT, CharT>
+        [[nodiscard]]
+        std::vector<CppStringT> split(const ChT sep, size_type maxsplit = -1) const noexcept
+        {
+            SplitBufferT<CharT, TraitsT, AllocatorT> res{};
+            res.reserve(std::min(this->count(sep), maxsplit) + 1);
+            this->split_into(res, sep, maxsplit);
+            return std::move(res).release();
+        }
+
+
+        //---   split_any()   -------------------------------------
+        /** \brief Returns a vector of the words in the string, using any character of set seps as a delimiter. At most maxsplit splits are done, the leftmost ones.
+        *
+        * Consecutive delimiters are not grouped together and are deemed to
+        * delimit empty strings, as with method split(sep).
+        */
+        [[nodiscard]]
+        std::vector<CppStringT> split_any(const CharSetT<CharT>& seps, size_type maxsplit = -1) const
+        {
+            std::vector<CppStringT> res{};
+            auto word{ this->cbegin() };
+            for (auto it = this->cbegin(); maxsplit > 0 && it != this->cend(); ++it) {
+                if (seps.contains(*it)) [[unlikely]] {
+                    res.emplace_back(word, it);
+                    word = it + 1;
+                    --maxsplit;
+                }
+            }
+            res.emplace_back(word, this->cend());
+            return res;
+        }
+
+
+        //---   split_into()   ------------------------------------
+        /** \brief Sets out with the words in the string, using sep as the delimiter string. At most maxsplit splits are done, the leftmost ones. Returns a reference to out.
+        *
+        * The strings already contained in out get overwritten in place, so
+        * that their capacities and the one of out are reused: once out has
+        * grown enough, splitting allocates no memory. The strings of out
+        * beyond the count of words are kept alive for the next calls, see
+        * SplitBufferT.  Splitting an empty string returns {""}, while
+        * splitting a string in which sep is not found returns the string
+        * itself, as Python str.split(sep) does. An empty sep does not split
+        * the string.
+        */
+        SplitBufferT<CharT, TraitsT, AllocatorT>& split_into(SplitBufferT<CharT, TraitsT, AllocatorT>& out, const CppStringT& sep, size_type maxsplit = -1) const
+        {
+            const std::basic_string_view<CharT, TraitsT> this_view(*this);
+            const size_type sep_size{ sep.size() };
+            size_type word_start{ 0 };
+            size_type index{ 0 };
+            out.clear();
+            if (sep_size > 0) [[likely]] {
+                while (maxsplit > 0 && (index = this_view.find(sep, word_start)) != CppStringT::npos) {
+                    out.push_back(this_view.data() + word_start, index - word_start);
+                    word_start = index + sep_size;
+                    --maxsplit;
                 }
+            }
+            out.push_back(this_view.data() + word_start, this_view.size() - word_start);
+            return out;
+        }
 
-                if (indexes.size() == 0)
-                    res.push_back(*this);
-                else {
-                    index = 0;
-                    for (const size_type ndx : indexes) {
-                        res.push_back(this->substr(index, ndx - index));
-                        index = ndx + sep_size;
-                    }
+        /** \brief Sets out with the words in the string, using character sep as the delimiter. At most maxsplit splits are done, the leftmost ones. Returns a reference to out.
+        *
+        * Same as split_into(out, sep, maxsplit) with a string separator.
+        */
+        template<class ChT>
+            requires std::same_as<ChT, CharT>
+        SplitBufferT<CharT, TraitsT, AllocatorT>& split_into(SplitBufferT<CharT, TraitsT, AllocatorT>& out, const ChT sep, size_type maxsplit = -1) const
+        {
+            const CharT* const chars{ this->data() };
+            const CharT* const last{ chars + this->size() };
+            const CharT* word{ chars };
+            const CharT* found{ nullptr };
+            out.clear();
+            while (maxsplit > 0 && (found = TraitsT::find(word, last - word, sep)) != nullptr) {
+                out.push_back(word, found - word);
+                word = found + 1;
+                --maxsplit;
+            }
+            out.push_back(word, last - word);
+            return out;
+        }
+
+
+        //---   split_interned()   --------------------------------
+        /** \brief Same as split() but returns a vector of interned strings.
+        *
+        * Each word is interned into the global pool of interned strings
+        * directly  from  the content of this string,  without creating
+        * any temporary string. \see pcs::intern() and CppInternedT.
+        */
+        [[nodiscard]]
+        inline std::vector<CppInternedT<CharT, TraitsT>> split_interned() const
+        {
+            return split_interned(CppStringT(value_type(' ')));
+        }
+
+        /** \brief Same as split(sep, maxsplit) but returns a vector of interned strings.
+        *
+        * Each word is interned into the global pool of interned strings
+        * directly  from  the content of this string,  without creating
+        * any temporary string. \see pcs::intern() and CppInternedT.
+        * Words are the ones of split_into(): splitting an empty string
+        * returns {""} and an empty sep does not split the string.
+        */
+        [[nodiscard]]
+        std::vector<CppInternedT<CharT, TraitsT>> split_interned(const CppStringT& sep, size_type maxsplit = -1) const
+        {
+            auto& pool = InternPoolT<CharT, TraitsT>::global();
+            const std::basic_string_view<CharT, TraitsT> this_view(*this);
+            const size_type sep_size{ sep.size() };
+            std::vector<CppInternedT<CharT, TraitsT>> res;
+            size_type word_start{ 0 };
+            size_type index{ 0 };
+            if (sep_size > 0) [[likely]] {
+                while (maxsplit > 0 && (index = this_view.find(sep, word_start)) != CppStringT::npos) {
+                    res.push_back(pool.intern(this_view.substr(word_start, index - word_start)));
+                    word_start = index + sep_size;
+                    --maxsplit;
+                }
+            }
+            res.push_back(pool.intern(this_view.substr(word_start)));
+            return res;
+        }
+
+
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns a vector of the words in the string, using sep as the delimiter string, as split(sep) does, splitting on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings.  The string is cut into chunks that
+        * get searched for sep on threads_count threads  (0 stands for  the
+        * count of hardware threads). Occurrences of sep straddling two chunks
+        * are fixed up afterwards, so that the words are exactly the ones of
+        * split(sep),  even with self-overlapping separators such as "aa".
+        * The words are then copied in parallel into the resulting vector,
+        * in order. Short strings get split on the calling thread only.
+        * Other policies run method split(sep) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        std::vector<CppStringT> split(ExecutionPolicyT&&, const CppStringT& sep, const size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>) {
+                SplitBufferT<CharT, TraitsT, AllocatorT> res{};
+                this->split_into(res, sep);
+                return std::move(res).release();
+            }
+            else {
+                const std::vector<size_type> seps_pos{ _parallel_find_all(sep, threads_count) };
+                return _parallel_strings(seps_pos.size() + 1, _words_getter(seps_pos, sep.size()), threads_count);
+            }
+        }
+
+        /** \brief Same as split(policy, sep, threads_count) but returns the words in a column of strings. \see StringColumnT. */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        StringColumnT<CharT, TraitsT> split_column(ExecutionPolicyT&&, const CppStringT& sep, size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                threads_count = 1;
+            const std::vector<size_type> seps_pos{ _parallel_find_all(sep, threads_count) };
+            StringColumnT<CharT, TraitsT> res{};
+            res.assign(seps_pos.size() + 1, _words_getter(seps_pos, sep.size()), threads_count);
+            return res;
+        }
+#endif
+
+
+        //---   split_whitespace()   ------------------------------
+        /** \brief Returns a vector of the words in the string, as separated with runs of whitespaces. At most maxsplit splits are done, the leftmost ones.
+        *
+        * This is the c++ implementation of Python str.split() when called
+        * without separator:  runs of consecutive whitespaces are regarded
+        * as single separators,  whitespaces are all the characters of set
+        * CharSetT::whitespaces()  (spaces, tabs, newlines, etc.),  and the
+        * result contains no empty strings. Leading whitespaces are ignored
+        * and,  when maxsplit splits have been done,  the remaining part of
+        * the string is the last word,  trailing whitespaces included.  For
+        * instance, " a\tb  c ".split_whitespace(1) returns {"a", "b  c "}.
+        *
+        * Whitespaces are classified via a bitmap and the resulting vector
+        * is sized with a counting pre-pass over the string.
+        */
+        [[nodiscard]]
+        std::vector<CppStringT> split_whitespace(size_type maxsplit = -1) const
+        {
+            static const CharSetT<CharT> whitespaces{ CharSetT<CharT>::whitespaces() };
+            const CharT* const chars{ this->data() };
+            const size_type size{ this->size() };
+
+            // counting pre-pass: each non-whitespace character following a whitespace one starts a word
+            size_type words_count{ 0 };
+            bool prev_is_space{ true };
+            for (size_type index = 0; index < size; ++index) {
+                const bool is_space{ whitespaces.contains(chars[index]) };
+                words_count += size_type(prev_is_space && !is_space);
+                prev_is_space = is_space;
+            }
+
+            std::vector<CppStringT> res{};
+            res.reserve(words_count > maxsplit ? maxsplit + 1 : words_count);
+
+            size_type index{ 0 };
+            while (true) {
+                while (index < size && whitespaces.contains(chars[index]))
+                    ++index;
+                if (index == size)
+                    break;
+
+                if (maxsplit == 0) [[unlikely]] {
+                    res.emplace_back(chars + index, size - index);
+                    break;
                 }
-                res.push_back(this->substr(index, this->size() - index));
+
+                const size_type start{ index };
+                while (index < size && !whitespaces.contains(chars[index]))
+                    ++index;
+                res.emplace_back(chars + start, index - start);
+                --maxsplit;
             }
 
             return res;
@@ -1670,67 +3164,102 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         std::vector<CppStringT> splitlines(const bool keep_end = false) const noexcept
         {
-            std::vector<CppStringT> res{};
-            CppStringT current{};
-            bool prev_cr = false;
+            SplitBufferT<CharT, TraitsT, AllocatorT> res{};
+            this->splitlines_into(res, keep_end);
+            return std::move(res).release();
+        }
 
-            for (const value_type ch : *this) {
-                switch (ch) {
-                case 0x0b:  [[unlikely]]        // Line Tabulation, \v as well as \x0b and \013
-                case 0x0c:  [[unlikely]]        // Form Feed, \f as well as \x0c and \014
-                case 0x1c:  [[unlikely]]        // File Separator, or \034
-                case 0x1d:  [[unlikely]]        // Group Separator, or \035
-                case 0x1e:  [[unlikely]]        // Record Separator, or \036
-                //case L'\u0085':   [[unlikely]]  // Next Line (C1 Control Code), or \0205
-                //case L'\u2028':   [[unlikely]]  // Line Separator
-                //case L'\u2029':   [[unlikely]]  // Paragraph Separator
-                    if (prev_cr) [[unlikely]] {
-                        res.push_back(current);
-                        current.clear();
-                    }
-                    if (keep_end) [[unlikely]]
-                        current += ch;
-                    res.push_back(current);
-                    current.clear();
-                    prev_cr = false;
-                    break;
 
-                case value_type('\r'): [[unlikely]]      // Line Feed
-                    if (prev_cr) [[unlikely]] {
-                        res.push_back(current);
-                        current.clear();
-                    }
-                    if (keep_end) [[unlikely]]
-                        current += ch;
-                    prev_cr = true;
-                    break;
+        //---   splitlines_into()   -------------------------------
+        /** \brief Sets out with the lines in the string, breaking at line boundaries, as splitlines() does. Returns a reference to out.
+        *
+        * The strings already contained in out get overwritten in place, so
+        * that their capacities and the one of out are reused: once out has
+        * grown enough, splitting allocates no memory. The strings of out
+        * beyond the count of lines are kept alive for the next calls.
+        */
+        SplitBufferT<CharT, TraitsT, AllocatorT>& splitlines_into(SplitBufferT<CharT, TraitsT, AllocatorT>& out, const bool keep_end = false) const
+        {
+            using uchar_type = std::make_unsigned_t<CharT>;
+            const CharT* const chars{ this->data() };
+            const size_type size{ this->size() };
+            size_type line_start{ 0 };
+            size_type index{ 0 };
+            out.clear();
+
+            while (index < size) {
+                const value_type ch{ chars[index] };
+                if (uchar_type(ch) > uchar_type(0x1e)) [[likely]] {
+                    ++index;
+                    continue;
+                }
 
-                case value_type('\n'): [[unlikely]]      // Carriage return
-                    if (keep_end) [[unlikely]]
-                        current += ch;
-                    res.push_back(current);
-                    current.clear();
-                    prev_cr = false;
+                switch (ch) {
+                case value_type('\n'):     // Line Feed
+                case value_type('\r'):     // Carriage Return
+                case 0x0b:                  // Line Tabulation, \v as well as \x0b and \013
+                case 0x0c:                  // Form Feed, \f as well as \x0c and \014
+                case 0x1c:                  // File Separator, or \034
+                case 0x1d:                  // Group Separator, or \035
+                case 0x1e:                  // Record Separator, or \036
+                {
+                    const size_type eol_size{ (ch == value_type('\r') && index + 1 < size && chars[index + 1] == value_type('\n')) ? size_type(2) : size_type(1) };
+                    out.push_back(chars + line_start, index - line_start + (keep_end ? eol_size : 0));
+                    index += eol_size;
+                    line_start = index;
                     break;
+                }
 
-
-                default: [[likely]]
-                    if (prev_cr) [[unlikely]] {
-                        res.push_back(current);
-                        current.clear();
-                        prev_cr = false;
-                    }
-                    current += ch;
+                default:
+                    ++index;
                     break;
                 }
             }
 
-            if (prev_cr) [[unlikely]] {
-                res.push_back(current);
+            if (line_start < size) [[unlikely]]
+                out.push_back(chars + line_start, size - line_start);
+            return out;
+        }
+
+
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns a vector of the lines in the string, breaking at line boundaries, as splitlines(keep_end) does, splitting on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings.  The string is cut into chunks that
+        * get searched for line breaks on threads_count threads (0 stands for
+        * the count of hardware threads), a pair "\r\n" straddling two chunks
+        * being kept as one single line break. The lines are then copied in
+        * parallel into the resulting vector,  in order.  Short strings get
+        * split on the calling thread only.  Other policies run method
+        * splitlines(keep_end) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        std::vector<CppStringT> splitlines(ExecutionPolicyT&&, const bool keep_end = false, const size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                return splitlines(keep_end);
+            else {
+                const std::vector<size_type> bounds{ _parallel_lines_bounds(threads_count) };
+                return _parallel_strings(bounds.size() - 1, _lines_getter(bounds, keep_end), threads_count);
             }
+        }
 
+        /** \brief Same as splitlines(policy, keep_end, threads_count) but returns the lines in a column of strings. \see StringColumnT. */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        StringColumnT<CharT, TraitsT> splitlines_column(ExecutionPolicyT&&, const bool keep_end = false, size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                threads_count = 1;
+            const std::vector<size_type> bounds{ _parallel_lines_bounds(threads_count) };
+            StringColumnT<CharT, TraitsT> res{};
+            res.assign(bounds.size() - 1, _lines_getter(bounds, keep_end), threads_count);
             return res;
         }
+#endif
 
 
         //---   startswith()   ------------------------------------
@@ -1804,7 +3333,34 @@ namespace pcs // i.e. "pythonic c++ strings"
         [[nodiscard]]
         inline CppStringT strip(const CppStringT& removedchars) const noexcept
         {
-            return this->rstrip(removedchars).lstrip(removedchars);
+            return this->strip(CharSetT<CharT>(removedchars));
+        }
+
+        /** \brief Returns a copy of the string with its leading and trailing characters that are in set removedchars removed.
+        *
+        * For instance, s.strip(CharSet::whitespaces()) removes all the
+        * whitespaces that Python removes, not only the ASCII spaces. This is
+        * a template, constrained to sets of characters, so that braced lists
+        * of characters select strip(const CppStringT&).
+        */
+        template<class SetT>
+            requires std::same_as<SetT, CharSetT<CharT>>
+        [[nodiscard]]
+        inline CppStringT strip(const SetT& removedchars) const noexcept
+        {
+            const auto first{ std::find_if_not(this->cbegin(), this->cend(), std::cref(removedchars)) };
+            const auto last{ std::find_if_not(this->crbegin(), std::make_reverse_iterator(first), std::cref(removedchars)).base() };
+            return CppStringT(first, last);
+        }
+
+        /** \brief Returns a copy of the string with the leading and trailing characters ch removed. */
+        [[nodiscard]]
+        inline CppStringT strip(const value_type ch) const noexcept
+        {
+            const size_type first{ this->find_first_not_of(ch) };
+            if (first == CppStringT::npos) [[unlikely]]
+                return CppStringT();
+            return CppStringT(this->data() + first, this->find_last_not_of(ch) - first + 1);
         }
 
         /** \brief Returns a copy of the string with the leading and trailing whitespaces removed. */
@@ -1815,6 +3371,61 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   strip_into()   ------------------------------------
+        /** \brief Outputs the string with its leading and trailing characters removed via output iterator out, as strip() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt strip_into(OutputIt out, const CppStringT& removedchars) const
+        {
+            const CharSetT<CharT> is_removed(removedchars);
+            auto first{ this->cbegin() };
+            auto last{ this->cend() };
+            while (first != last && is_removed(*first))
+                ++first;
+            while (last != first && is_removed(*(last - 1)))
+                --last;
+            return std::copy(first, last, out);
+        }
+
+        /** \brief Outputs the string with its leading and trailing whitespaces removed via output iterator out, as strip() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        inline OutputIt strip_into(OutputIt out) const
+        {
+            auto first{ this->cbegin() };
+            auto last{ this->cend() };
+            while (first != last && *first == value_type(' '))
+                ++first;
+            while (last != first && *(last - 1) == value_type(' '))
+                --last;
+            return std::copy(first, last, out);
+        }
+
+        /** \brief Writes the string with its leading and trailing characters removed into the caller-provided span dest, as strip() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type strip_into(std::span<CharT> dest, const CppStringT& removedchars) const
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->strip_into(output.begin(), removedchars);
+            return output.count();
+        }
+
+        /** \brief Writes the string with its leading and trailing whitespaces removed into the caller-provided span dest, as strip() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type strip_into(std::span<CharT> dest) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->strip_into(output.begin());
+            return output.count();
+        }
+
+
         //---   substr()   ----------------------------------------
         /** \brief Returns a copy of the string, starting at index start and ending after count characters. */
         [[nodiscard]]
@@ -1841,6 +3452,52 @@ namespace pcs // i.e. "pythonic c++ strings"
             return res;
         }
 
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns a copy of the string with uppercase characters converted to lowercase and vice versa, converting on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings, cut into chunks converted on
+        * threads_count threads (0 stands for the count of hardware threads).
+        * Other policies run method swapcase() on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        CppStringT swapcase(ExecutionPolicyT&&, const size_type threads_count = 0) const
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                return swapcase();
+            else {
+                // converting starts threads and may throw, so it cannot run within resize_and_overwrite()
+                CppStringT res{};
+                res.resize(this->size());
+                _parallel_transform(res.data(), [](const value_type ch) { return pcs::swap_case(ch); }, threads_count);
+                return res;
+            }
+        }
+#endif
+
+
+        //---   swapcase_into()   ---------------------------------
+        /** \brief Outputs the string with its uppercase characters converted to lowercase and vice versa via output iterator out. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt swapcase_into(OutputIt out) const
+        {
+            return std::transform(this->cbegin(), this->cend(), out, [](const value_type ch) -> value_type { return pcs::swap_case(ch); });
+        }
+
+        /** \brief Writes the string with its uppercase characters converted to lowercase and vice versa into the caller-provided span dest.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type swapcase_into(std::span<CharT> dest) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->swapcase_into(output.begin());
+            return output.count();
+        }
+
 
         //---   title()   -----------------------------------------
         /** \brief Returns a titlecased copy of the string where words start with an uppercase character and the remaining characters are lowercase. */
@@ -1859,6 +3516,46 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   to_float()   --------------------------------------
+        /** \brief Returns the floating-point number written in the string, as Python float() does.
+        *
+        * See try_to_float() for the accepted syntax. Raises ValueException
+        * when the string is not a valid number. Numbers too large for FloatT
+        * get converted to infinities, as Python does.
+        */
+        template<class FloatT = double>
+            requires std::floating_point<FloatT>
+        [[nodiscard]]
+        FloatT to_float() const
+        {
+            const std::expected<FloatT, std::errc> res{ try_to_float<FloatT>() };
+            if (res.has_value()) [[likely]]
+                return *res;
+            throw ValueException("could not convert string to float.");
+        }
+
+
+        //---   to_int()   ----------------------------------------
+        /** \brief Returns the integer written in the string in base, as Python int() does.
+        *
+        * See try_to_int() for the accepted syntax. Raises ValueException when
+        * the string is not a valid integer in base, or std::out_of_range when
+        * the integer is out of the range of IntT.
+        */
+        template<class IntT = int>
+            requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+        [[nodiscard]]
+        IntT to_int(const int base = 10) const
+        {
+            const std::expected<IntT, std::errc> res{ try_to_int<IntT>(base) };
+            if (res.has_value()) [[likely]]
+                return *res;
+            if (res.error() == std::errc::result_out_of_range)
+                throw std::out_of_range("int() result out of range.");
+            throw ValueException(std::format("invalid literal for int() with base {}.", base));
+        }
+
+
         //---   translate()   -------------------------------------
         /** \brief Returns a copy of the string in which each character has been mapped through the given translation table.
         *
@@ -1877,6 +3574,149 @@ namespace pcs // i.e. "pythonic c++ strings"
             return res;
         }
 
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief Returns a copy of the string in which each character has been mapped through the given translation table, translating on several threads when policy is std::execution::par or par_unseq.
+        *
+        * Meant for very large strings, cut into chunks translated on
+        * threads_count threads (0 stands for the count of hardware threads).
+        * When the table maps some characters to strings that are not one
+        * single character long,  the lengths of the translated chunks are
+        * computed first, their offsets in the result being their prefix
+        * sums. The result is then allocated once and filled in parallel.
+        * Other policies run method translate(table) on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        [[nodiscard]]
+        CppStringT translate(ExecutionPolicyT&&, TransTable& table, const size_type threads_count = 0)
+        {
+            if constexpr (!is_parallel_policy_v<ExecutionPolicyT>)
+                return translate(table);
+            else {
+                using uchar_type = std::make_unsigned_t<CharT>;
+                using view_type = std::basic_string_view<CharT, TraitsT>;
+                const auto& entries{ table.get_table() };
+
+                // the translations of the 256 first characters are looked up in an array, the other ones in the table
+                std::array<const CppStringT*, 256> low_entries{};
+                bool same_size{ true };
+                for (const auto& [key, value] : entries) {
+                    if (uchar_type(key) < 256)
+                        low_entries[uchar_type(key)] = &value;
+                    same_size = same_size && value.size() == 1;
+                }
+                const auto translated = [&entries, &low_entries](const value_type& ch) {
+                    const CppStringT* entry{ nullptr };
+                    if (uchar_type(ch) < 256) [[likely]]
+                        entry = low_entries[uchar_type(ch)];
+                    else if (const auto it = entries.find(ch); it != entries.cend())
+                        entry = &it->second;
+                    return (entry == nullptr) ? view_type(&ch, 1) : view_type(*entry);
+                };
+
+                const CharT* const chars{ this->data() };
+                const size_type chunks_count{ parallel_chunks_count(this->size(), threads_count, PARALLEL_MIN_CHARS) };
+                std::vector<size_type> offsets(chunks_count + 1);
+                if (same_size) [[likely]] {
+                    offsets[chunks_count] = this->size();
+                }
+                else [[unlikely]] {
+                    parallel_for_chunks(this->size(), chunks_count, [&](const size_type chunk, const size_type first, const size_type last) {
+                        size_type chunk_size{ 0 };
+                        for (size_type index = first; index < last; ++index)
+                            chunk_size += translated(chars[index]).size();
+                        offsets[chunk + 1] = chunk_size;
+                    });
+                    std::partial_sum(offsets.cbegin(), offsets.cend(), offsets.begin());
+                }
+
+                const size_type res_size{ offsets[chunks_count] };
+                const auto fill = [&](CharT* const out) {
+                    parallel_for_chunks(this->size(), chunks_count, [&](const size_type chunk, const size_type first, const size_type last) {
+                        CharT* dest{ out + (same_size ? first : offsets[chunk]) };
+                        for (size_type index = first; index < last; ++index) {
+                            const view_type translation{ translated(chars[index]) };
+                            dest = std::copy(translation.cbegin(), translation.cend(), dest);
+                        }
+                    });
+                };
+
+                // filling starts threads and may throw, so it cannot run within resize_and_overwrite()
+                CppStringT res{};
+                res.resize(res_size);
+                fill(res.data());
+                return res;
+            }
+        }
+#endif
+
+
+        //---   translate_into()   --------------------------------
+        /** \brief Outputs the string with each of its characters mapped through the given translation table via output iterator out, as translate() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt translate_into(OutputIt out, TransTable& table) const
+        {
+            for (const value_type ch : *this) {
+                const CppStringT translated{ table[ch] };
+                out = std::copy(translated.cbegin(), translated.cend(), out);
+            }
+            return out;
+        }
+
+        /** \brief Writes the string with each of its characters mapped through the given translation table into the caller-provided span dest, as translate() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type translate_into(std::span<CharT> dest, TransTable& table) const
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->translate_into(output.begin(), table);
+            return output.count();
+        }
+
+
+        //---   try_to_float()   ----------------------------------
+        /** \brief Returns the floating-point number written in the string, as Python float() does, or an error code.
+        *
+        * Leading and trailing whitespaces are ignored, the number may have a
+        * sign and may be "inf", "infinity" or "nan" in any case, and single
+        * underscores may separate its decimal digits.  As with Python, too
+        * large numbers get converted to signed infinities, e.g. "1e999", and
+        * too small ones to zeros.  The error code is std::errc::invalid_argument
+        * when the string is not a valid number. No exception is raised.
+        */
+        template<class FloatT = double>
+            requires std::floating_point<FloatT>
+        [[nodiscard]]
+        inline std::expected<FloatT, std::errc> try_to_float() const
+        {
+            return pcs::try_to_float<FloatT>(std::basic_string_view<CharT, TraitsT>(*this));
+        }
+
+
+        //---   try_to_int()   ------------------------------------
+        /** \brief Returns the integer written in the string in base, as Python int() does, or an error code.
+        *
+        * Base is either 0 or from 2 to 36.  Leading and trailing whitespaces
+        * are ignored, the integer may have a sign, digits above 9 are letters
+        * in any case,  and single underscores may separate its digits.  The
+        * integer may be prefixed with 0x, 0o or 0b when base is 16, 8 or 2
+        * respectively, or 0: base is then got from the prefix, with base 10
+        * being the default and leading zeros being rejected, as with Python
+        * integer literals.  The error code is std::errc::invalid_argument
+        * when the string is not a valid integer, or std::errc::result_out_of_range
+        * when the integer is out of the range of IntT.
+        */
+        template<class IntT = int>
+            requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+        [[nodiscard]]
+        inline std::expected<IntT, std::errc> try_to_int(const int base = 10) const
+        {
+            return pcs::try_to_int<IntT>(std::basic_string_view<CharT, TraitsT>(*this), base);
+        }
+
 
         //---   upper ()  -----------------------------------------
         /** \brief In-place replaces all characters of the string with their uppercase conversion. Returns a reference to string.
@@ -1891,6 +3731,25 @@ namespace pcs // i.e. "pythonic c++ strings"
             return *this = res;
         }
 
+#if defined(PCS_EXECUTION_POLICIES)
+        /** \brief In-place replaces all characters of the string with their uppercase conversion, converting on several threads when policy is std::execution::par or par_unseq. Returns a reference to string.
+        *
+        * Meant for very large strings, cut into chunks converted on
+        * threads_count threads (0 stands for the count of hardware threads).
+        * Other policies run method upper() on the calling thread.
+        */
+        template<class ExecutionPolicyT>
+            requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+        CppStringT& upper(ExecutionPolicyT&&, const size_type threads_count = 0)
+        {
+            if constexpr (is_parallel_policy_v<ExecutionPolicyT>)
+                _parallel_transform(this->data(), [](const value_type ch) { return CppStringT::upper(ch); }, threads_count);
+            else
+                upper();
+            return *this;
+        }
+#endif
+
         /** \brief Returns uppercase conversion of the character.
         *
         * Notice: uses the currently set std::locale, which is the "C" one
@@ -1903,6 +3762,32 @@ namespace pcs // i.e. "pythonic c++ strings"
         }
 
 
+        //---   upper_into()   ------------------------------------
+        /** \brief Outputs the uppercase conversion of the string via output iterator out. Returns the iterator past the last output character.
+        *
+        * The string itself remains unchanged. Notice: uses the currently set
+        * std::locale, as method upper() does.
+        */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt upper_into(OutputIt out) const
+        {
+            return std::transform(this->cbegin(), this->cend(), out, [](const value_type ch) { return CppStringT::upper(ch); });
+        }
+
+        /** \brief Writes the uppercase conversion of the string into the caller-provided span dest.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type upper_into(std::span<CharT> dest) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->upper_into(output.begin());
+            return output.count();
+        }
+
+
         //---   zfill()   -----------------------------------------
         /** \brief Returns a copy of the string left filled with ASCII '0' digits to make a string of length width.
         *
@@ -1916,41 +3801,653 @@ namespace pcs // i.e. "pythonic c++ strings"
             if (this->size() >= width) [[unlikely]]
                 return *this;
 
-            const size_type padding_width = width - this->size();
+            const FillRunT<CharT, TraitsT> padding{ width - this->size(), value_type('0') };
             if ((*this)[0] == '-' || (*this)[0] == '+') [[unlikely]]
-                return (*this)[0] + this->substr(1, this->size() - 1).ljust(width - 1, value_type('0'));
+                return ConcatCharT<CharT, TraitsT>{ (*this)[0] } + padding + std::basic_string_view<CharT, TraitsT>(this->data() + 1, this->size() - 1);
             else [[likely]]
-                return this->ljust(width, value_type('0'));
+                return padding + *this;
         }
 
-    };
-
 
-    //=====   litteral operators   ============================
-    /** \brief  Forms a CppString literal. */
-    inline CppString operator""_cs(const char* str, std::size_t len)
-    {
-        return CppString(CppString::MyBaseClass(str, len));
-    }
+        //---   zfill_into()   ------------------------------------
+        /** \brief Outputs the string left filled with ASCII '0' digits to make a string of length width via output iterator out, as zfill() does. Returns the iterator past the last output character. */
+        template<std::output_iterator<const CharT&> OutputIt>
+        OutputIt zfill_into(OutputIt out, const size_type width) const
+        {
+            if (this->size() >= width) [[unlikely]]
+                return std::copy(this->cbegin(), this->cend(), out);
 
-    /** \brief Forms a CppWString literal. */
-    inline CppWString operator""_cs(const wchar_t* str, std::size_t len)
-    {
-        return CppWString(CppWString::MyBaseClass(str, len));
-    }
+            auto first{ this->cbegin() };
+            if (*first == value_type('-') || *first == value_type('+')) [[unlikely]]
+                *out++ = *first++;
+            out = std::fill_n(out, width - this->size(), value_type('0'));
+            return std::copy(first, this->cend(), out);
+        }
 
+        /** \brief Writes the string left filled with ASCII '0' digits to make a string of length width into the caller-provided span dest, as zfill() does.
+        *
+        * At most dest.size() characters are written into dest. Returns the
+        * length of the whole result:  when it is greater than dest.size(),
+        * the result has been truncated to its dest.size() first characters.
+        */
+        inline size_type zfill_into(std::span<CharT> dest, const size_type width) const noexcept
+        {
+            BoundedOutputT<CharT> output(dest);
+            this->zfill_into(output.begin(), width);
+            return output.count();
+        }
 
-    //=====   Slices   ========================================
-    //---   slices base   -------------------------------------
-    /** \brief Base class for slices, with start, stop and step specified values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    class Slice
-    {
-    public:
-        static constexpr IntT DEFAULT{ std::numeric_limits<IntT>::min() };
 
-        //---   Constructors / Destructor   -------------------
+    private:
+        /** \brief Returns the size of the string with its tabs expanded, tabsize_ being not null. Sets tabs_count with the count of tabs in the string. */
+        [[nodiscard]]
+        size_type _expanded_tabs_size(const size_type tabsize_, size_type& tabs_count) const noexcept
+        {
+            // each run of characters between tabs and line breaks starts at a column multiple of tabsize
+            const CharT* const last{ this->data() + this->size() };
+            size_type res_size{ this->size() };
+            tabs_count = 0;
+            for (const CharT* run = this->data(), *stop; (stop = _find_tab_or_eol(run, last)) != last; run = stop + 1) {
+                if (*stop == value_type('\t')) {
+                    res_size += tabsize_ - size_type(stop - run) % tabsize_ - 1;
+                    ++tabs_count;
+                }
+            }
+            return res_size;
+        }
+
+        /** \brief Returns a pointer to the first tab or line break ('\n' or '\r') in [first, last), or last if there is none.
+        *
+        * char strings get scanned eight characters at a time:  tabs and line
+        * breaks are among the characters with codes less than 0x0e,  which
+        * get all detected at once with arithmetic on 64-bits words.
+        */
+        [[nodiscard]]
+        static const CharT* _find_tab_or_eol(const CharT* first, const CharT* const last) noexcept
+        {
+            if constexpr (sizeof(CharT) == 1) {
+                for (; last - first >= 8; first += 8) {
+                    if (_has_control_char(first)) [[unlikely]] {
+                        for (const CharT* ch = first; ch != first + 8; ++ch)
+                            if (_is_tab_or_eol(*ch))
+                                return ch;
+                    }
+                }
+            }
+            return std::find_if(first, last, _is_tab_or_eol);
+        }
+
+        /** \brief Returns true if one of the eight chars at chars has a code less than 0x0e, or false otherwise. */
+        [[nodiscard]]
+        static inline bool _has_control_char(const CharT* const chars) noexcept
+        {
+            std::uint64_t word;
+            std::memcpy(&word, chars, sizeof(word));
+            return ((word - 0x0e0e0e0e0e0e0e0e) & ~word & 0x8080808080808080) != 0;
+        }
+
+        /** \brief Returns true if ch is a tab or one of the line breaks that reset columns in expand_tabs(), or false otherwise. */
+        [[nodiscard]]
+        static inline bool _is_tab_or_eol(const value_type ch) noexcept
+        {
+            return ch == value_type('\t') || ch == value_type('\n') || ch == value_type('\r');
+        }
+
+        /** \brief Returns a pointer right after the last tab or line break in [first, last), or first if there is none, as _find_tab_or_eol() does backwards. */
+        [[nodiscard]]
+        static const CharT* _rfind_run_start(const CharT* const first, const CharT* last) noexcept
+        {
+            if constexpr (sizeof(CharT) == 1) {
+                for (; last - first >= 8; last -= 8) {
+                    if (_has_control_char(last - 8)) [[unlikely]] {
+                        for (const CharT* ch = last; ch != last - 8; --ch)
+                            if (_is_tab_or_eol(ch[-1]))
+                                return ch;
+                    }
+                }
+            }
+            while (last != first && !_is_tab_or_eol(last[-1]))
+                --last;
+            return last;
+        }
+
+        /** \brief Returns the lowest index from first where sub is found ignoring case, the whole match being before index last, or npos if there is none. */
+        [[nodiscard]]
+        size_type _ifind(const std::basic_string_view<CharT, TraitsT> sub, const size_type first, const size_type last) const noexcept
+        {
+            if (last - first < sub.size()) [[unlikely]]
+                return CppStringT::npos;
+            if (sub.empty()) [[unlikely]]
+                return first;
+
+            const CharT head{ fold_case(sub[0]) };
+            const CharT* const chars{ this->data() };
+            for (size_type index = first; index <= last - sub.size(); ++index) {
+                if (fold_case(chars[index]) == head && IEqualT<CharT, TraitsT>::equal_n(chars + index + 1, sub.data() + 1, sub.size() - 1))
+                    return index;
+            }
+            return CppStringT::npos;
+        }
+
+        /** \brief Returns the index past the end of the range [start, end] of the methods with inclusive end positions, clamped to the string size. */
+        [[nodiscard]]
+        inline size_type _range_last(const size_type end) const noexcept
+        {
+            return (end >= this->size()) ? this->size() : end + 1;
+        }
+
+        /** \brief Returns true if ch is one of the line boundaries of method splitlines(), or false otherwise. */
+        [[nodiscard]]
+        static inline bool _is_line_break(const value_type ch) noexcept
+        {
+            using uchar_type = std::make_unsigned_t<CharT>;
+            if (uchar_type(ch) > uchar_type(0x1e)) [[likely]]
+                return false;
+            switch (ch) {
+            case value_type('\n'):
+            case value_type('\r'):
+            case 0x0b:
+            case 0x0c:
+            case 0x1c:
+            case 0x1d:
+            case 0x1e:
+                return true;
+            default:
+                return false;
+            }
+        }
+
+
+        //---   collation   -----------------------------------
+        static constexpr std::uint16_t COLLATION_COMMON{ 0x0020 };     //!< secondary and tertiary weight of unaccented and of uncased or lowercase characters
+        static constexpr std::uint16_t COLLATION_UPPER{ 0x0021 };      //!< tertiary weight of uppercase letters
+        static constexpr std::uint16_t COLLATION_NUMBER{ 0x100a };     //!< primary weight of the numbers of natural collation keys
+
+        /** \brief Appends to primary, secondary and tertiary the collation weights of code_point, see method sort_key(). */
+        static void _append_collation_weights(const char32_t code_point, std::string& primary, std::string& secondary, std::string& tertiary)
+        {
+            // base letters of U+00C0 to U+017F, uppercase for capital letters, or ' ' for symbols
+            static constexpr std::string_view LATIN_BASES{
+                "AAAAAAACEEEEIIIIDNOOOOO OUUUUYTsaaaaaaaceeeeiiiidnooooo ouuuuyty"
+                "AaAaAaCcCcCcCcDdDdEeEeEeEeEeGgGgGgGgHhHhIiIiIiIiIiIiJjKkkLlLlLlL"
+                "lLlNnNnNnnNnOoOoOoOoRrRrRrSsSsSsSsTtTtTtUuUuUuUuUuUuWwYyYZzZzZzs"
+            };
+            // accents of U+00C0 to U+017F: offsets of their combining diacritical marks from U+0300, or 0x70 and above for letters without canonical decomposition
+            static constexpr std::uint8_t LATIN_ACCENTS[]{
+                0x00, 0x01, 0x02, 0x03, 0x08, 0x0a, 0x70, 0x27, 0x00, 0x01, 0x02, 0x08, 0x00, 0x01, 0x02, 0x08,
+                0x71, 0x03, 0x00, 0x01, 0x02, 0x03, 0x08, 0x00, 0x72, 0x00, 0x01, 0x02, 0x08, 0x01, 0x73, 0x74,
+                0x00, 0x01, 0x02, 0x03, 0x08, 0x0a, 0x70, 0x27, 0x00, 0x01, 0x02, 0x08, 0x00, 0x01, 0x02, 0x08,
+                0x71, 0x03, 0x00, 0x01, 0x02, 0x03, 0x08, 0x00, 0x72, 0x00, 0x01, 0x02, 0x08, 0x01, 0x73, 0x08,
+                0x04, 0x04, 0x06, 0x06, 0x28, 0x28, 0x01, 0x01, 0x02, 0x02, 0x07, 0x07, 0x0c, 0x0c, 0x0c, 0x0c,
+                0x75, 0x75, 0x04, 0x04, 0x06, 0x06, 0x07, 0x07, 0x28, 0x28, 0x0c, 0x0c, 0x02, 0x02, 0x06, 0x06,
+                0x07, 0x07, 0x27, 0x27, 0x02, 0x02, 0x76, 0x76, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x28, 0x28,
+                0x07, 0x77, 0x78, 0x78, 0x02, 0x02, 0x27, 0x27, 0x79, 0x01, 0x01, 0x27, 0x27, 0x0c, 0x0c, 0x7a,
+                0x7a, 0x7b, 0x7b, 0x01, 0x01, 0x27, 0x27, 0x0c, 0x0c, 0x7c, 0x7d, 0x7d, 0x04, 0x04, 0x06, 0x06,
+                0x0b, 0x0b, 0x7e, 0x7e, 0x01, 0x01, 0x27, 0x27, 0x0c, 0x0c, 0x01, 0x01, 0x02, 0x02, 0x27, 0x27,
+                0x0c, 0x0c, 0x27, 0x27, 0x0c, 0x0c, 0x7f, 0x7f, 0x03, 0x03, 0x04, 0x04, 0x06, 0x06, 0x0a, 0x0a,
+                0x0b, 0x0b, 0x28, 0x28, 0x02, 0x02, 0x02, 0x02, 0x08, 0x01, 0x01, 0x07, 0x07, 0x0c, 0x0c, 0x80,
+            };
+
+            std::uint16_t accent{ COLLATION_COMMON };
+            std::uint16_t letter_case{ COLLATION_COMMON };
+            if (code_point < 0x80) [[likely]] {
+                const char32_t lower{ code_point | 0x20 };
+                if (code_point <= 0x20 || code_point == 0x7f)
+                    _push_weight(primary, std::uint16_t(0x0200 + code_point));         // whitespaces and controls
+                else if (code_point >= '0' && code_point <= '9')
+                    _push_weight(primary, std::uint16_t(0x1000 + code_point - '0'));
+                else if (lower >= 'a' && lower <= 'z') {
+                    _push_weight(primary, _letter_weight(lower));
+                    if (code_point != lower)
+                        letter_case = COLLATION_UPPER;
+                }
+                else
+                    _push_weight(primary, std::uint16_t(0x0300 + code_point));         // punctuations and symbols
+            }
+            else if (code_point < 0xc0 || code_point == 0xd7 || code_point == 0xf7)
+                _push_weight(primary, std::uint16_t(0x0300 + code_point));             // Latin-1 punctuations and symbols
+            else if (code_point < 0x180) {
+                const char32_t base{ char32_t(LATIN_BASES[code_point - 0xc0]) };
+                _push_weight(primary, _letter_weight(base | 0x20));
+                accent = std::uint16_t(COLLATION_COMMON + 1 + LATIN_ACCENTS[code_point - 0xc0]);
+                if (base < 'a')
+                    letter_case = COLLATION_UPPER;
+            }
+            else if (code_point >= 0x0300 && code_point <= 0x036f) {
+                // combining diacritical marks weigh at the secondary level only, accenting the preceding letter unless already accented
+                accent = std::uint16_t(COLLATION_COMMON + 1 + (code_point - 0x0300));
+                if (secondary.size() >= 2 && std::uint8_t(secondary.back()) == COLLATION_COMMON && secondary[secondary.size() - 2] == 0)
+                    secondary.resize(secondary.size() - 2);
+                _push_weight(secondary, accent);
+                return;
+            }
+            else {
+                char32_t folded{ code_point };
+                if ((code_point >= 0x0391 && code_point <= 0x03a9) || (code_point >= 0x0410 && code_point <= 0x042f)) {
+                    folded += 0x20;                                                     // Greek and Cyrillic capitals
+                    letter_case = COLLATION_UPPER;
+                }
+                else if (code_point >= 0x0400 && code_point <= 0x040f) {
+                    folded += 0x50;                                                     // Cyrillic capitals with diacritics
+                    letter_case = COLLATION_UPPER;
+                }
+                else if (code_point == 0x03c2) {
+                    folded = 0x03c3;                                                    // final sigma
+                    accent = COLLATION_COMMON + 1;
+                }
+                _push_weight(primary, std::uint16_t(0x8000 + (folded >> 15)));
+                _push_weight(primary, std::uint16_t(0x8000 | (folded & 0x7fff)));
+            }
+            _push_weight(secondary, accent);
+            _push_weight(tertiary, letter_case);
+        }
+
+        /** \brief Returns the primary collation weight of the ASCII lowercase letter. */
+        [[nodiscard]]
+        static inline constexpr std::uint16_t _letter_weight(const char32_t lower) noexcept
+        {
+            return std::uint16_t(0x2000 + ((lower - 'a') << 4));
+        }
+
+        /** \brief Appends to key the 16-bits collation weight, big-endian so that keys compare byte per byte. */
+        static inline void _push_weight(std::string& key, const std::uint16_t weight)
+        {
+            key.push_back(char(weight >> 8));
+            key.push_back(char(weight & 0xff));
+        }
+
+
+        //---   formatting   ----------------------------------
+        /** \brief Appends to dest the characters of the UTF-8 text utf8, transcoded into UTF-8, UTF-16 or UTF-32 according to the type of characters of dest.
+        *
+        * Invalid sequences get transcoded as U+FFFD, whatever the type of
+        * characters. In UTF-8, runs of valid sequences get copied in bulk.
+        */
+        static void _append_utf8(CppStringT& dest, const std::string_view utf8)
+        {
+            if constexpr (sizeof(CharT) == 1) {
+                constexpr CharT REPLACEMENT_UTF8[]{ CharT(0xef), CharT(0xbf), CharT(0xbd) };
+                dest.reserve(dest.size() + utf8.size());
+                const char* it{ utf8.data() };
+                const char* const last{ it + utf8.size() };
+                const char* run{ it };
+                while (it != last) {
+                    const char* const sequence{ it };
+                    if (_next_code_point(it, last) == 0xfffd && it - sequence == 1) [[unlikely]] {
+                        dest.append(reinterpret_cast<const CharT*>(run), size_type(sequence - run));
+                        dest.append(REPLACEMENT_UTF8, 3);
+                        run = it;
+                    }
+                }
+                dest.append(reinterpret_cast<const CharT*>(run), size_type(last - run));
+            }
+            else {
+                dest.reserve(dest.size() + utf8.size());
+                const char* it{ utf8.data() };
+                const char* const last{ it + utf8.size() };
+                while (it != last) {
+                    const char32_t code_point{ _next_code_point(it, last) };
+                    if constexpr (sizeof(CharT) == 2) {
+                        if (code_point >= 0x10000) [[unlikely]] {
+                            dest.push_back(CharT(0xd800 + ((code_point - 0x10000) >> 10)));
+                            dest.push_back(CharT(0xdc00 + ((code_point - 0x10000) & 0x3ff)));
+                            continue;
+                        }
+                    }
+                    dest.push_back(CharT(code_point));
+                }
+            }
+        }
+
+        /** \brief Decodes the code point of the UTF-8, UTF-16 or UTF-32 text at it, according to the size of UnitT, and moves it past it.
+        *
+        * Invalid, overlong or truncated sequences and lone surrogates are
+        * decoded as U+FFFD, it being then moved by one unit only.
+        */
+        template<class UnitT>
+        [[nodiscard]]
+        static char32_t _next_code_point(const UnitT*& it, const UnitT* const last) noexcept
+        {
+            constexpr char32_t REPLACEMENT_CHAR{ 0xfffd };
+            using unit_type = std::make_unsigned_t<UnitT>;
+
+            if constexpr (sizeof(UnitT) == 1) {
+                const unsigned char lead{ static_cast<unsigned char>(*it) };
+                if (lead < 0x80) [[likely]] {
+                    ++it;
+                    return lead;
+                }
+                std::ptrdiff_t length{ (lead >= 0xf0 && lead <= 0xf4) ? 4 : (lead >= 0xe0 && lead < 0xf0) ? 3 : (lead >= 0xc2 && lead < 0xe0) ? 2 : 0 };
+                char32_t code_point{ char32_t(lead & (0x7f >> length)) };
+                for (std::ptrdiff_t next = 1; next < length; ++next) {
+                    const unsigned char cont{ (next < last - it) ? static_cast<unsigned char>(it[next]) : static_cast<unsigned char>(0) };
+                    if ((cont & 0xc0) != 0x80) {
+                        length = 0;
+                        break;
+                    }
+                    code_point = (code_point << 6) | (cont & 0x3f);
+                }
+                constexpr char32_t MIN_CODE_POINTS[]{ 0, 0, 0x80, 0x800, 0x10000 };
+                if (length == 0 || code_point < MIN_CODE_POINTS[length] || code_point > 0x10ffff || (code_point >= 0xd800 && code_point <= 0xdfff)) {
+                    ++it;
+                    return REPLACEMENT_CHAR;
+                }
+                it += length;
+                return code_point;
+            }
+            else if constexpr (sizeof(UnitT) == 2) {
+                const char32_t unit{ unit_type(*it++) };
+                if (unit < 0xd800 || unit > 0xdfff) [[likely]]
+                    return unit;
+                if (unit <= 0xdbff && it != last && unit_type(*it) >= 0xdc00 && unit_type(*it) <= 0xdfff) {
+                    const char32_t low{ unit_type(*it++) };
+                    return 0x10000 + ((unit - 0xd800) << 10) + (low - 0xdc00);
+                }
+                return REPLACEMENT_CHAR;
+            }
+            else {
+                const char32_t code_point{ char32_t(unit_type(*it++)) };
+                return (code_point > 0x10ffff || (code_point >= 0xd800 && code_point <= 0xdfff)) ? REPLACEMENT_CHAR : code_point;
+            }
+        }
+
+        /** \brief Calls func with the buffer of formatted texts of the calling thread, cleared but keeping its capacity, or with a temporary buffer when nested calls already use it. */
+        template<class FormatCharT, class FuncT>
+        static void _with_format_buffer(FuncT&& func)
+        {
+            thread_local std::basic_string<FormatCharT> buffer{};
+            thread_local bool in_use{ false };
+            if (in_use) [[unlikely]] {
+                std::basic_string<FormatCharT> nested_buffer{};
+                func(nested_buffer);
+                return;
+            }
+
+            struct Release { bool& in_use; ~Release() { in_use = false; } };
+            in_use = true;
+            const Release release{ in_use };
+            buffer.clear();
+            func(buffer);
+        }
+
+        template<class... ArgsT>
+        [[nodiscard]]
+        static inline auto _make_format_args(ArgsT&... args)
+        {
+            if constexpr (std::is_same_v<CharT, wchar_t>)
+                return std::make_wformat_args(args...);
+            else
+                return std::make_format_args(args...);
+        }
+
+
+        //---   parallel transforms   -------------------------
+        /** \brief Writes into out the characters of this string, each one transformed by func, chunks of the string being transformed on several threads. out may be the data of this string. */
+        template<class FuncT>
+        void _parallel_transform(CharT* const out, FuncT&& func, const size_type threads_count) const
+        {
+            const CharT* const chars{ this->data() };
+            parallel_for_chunks(this->size(), parallel_chunks_count(this->size(), threads_count, PARALLEL_MIN_CHARS), [&](const size_type, const size_type first, const size_type last) {
+                std::transform(chars + first, chars + last, out + first, func);
+            });
+        }
+
+
+        //---   parallel searches   ---------------------------
+        /** \brief Returns the number of non-overlapping occurrences of sub in this string, as counted on several threads.
+        *
+        * Each chunk counts the occurrences that start in it,  chained from
+        * its first one.  When an occurrence straddles the next chunk,  the
+        * occurrences chained from its end get counted up to the first one
+        * that the chain of the next chunk also contains, from which both
+        * chains are the same.
+        */
+        [[nodiscard]]
+        size_type _parallel_count(const std::basic_string_view<CharT, TraitsT> sub, const size_type threads_count) const
+        {
+            using view_type = std::basic_string_view<CharT, TraitsT>;
+            struct ChunkCount { size_type first, last, count, next_pos; };
+
+            const view_type this_view(*this);
+            const size_type sub_size{ sub.size() };
+            const auto searched_view = [&](const size_type last) { return this_view.substr(0, std::min(last + sub_size - 1, this_view.size())); };
+
+            const size_type chunks_count{ parallel_chunks_count(this_view.size(), threads_count, PARALLEL_MIN_CHARS) };
+            std::vector<ChunkCount> chunks(chunks_count);
+            parallel_for_chunks(this_view.size(), chunks_count, [&](const size_type chunk, const size_type first, const size_type last) {
+                const view_type searched{ searched_view(last) };
+                size_type count{ 0 };
+                size_type next_pos{ first };
+                for (size_type pos = first; (pos = searched.find(sub, pos)) != view_type::npos; pos += sub_size) {
+                    ++count;
+                    next_pos = pos + sub_size;
+                }
+                chunks[chunk] = { first, last, count, next_pos };
+            });
+
+            size_type res{ 0 };
+            size_type next_pos{ 0 };    // i.e. the position just after the last counted occurrence
+            for (const ChunkCount& chunk : chunks) {
+                if (next_pos <= chunk.first) [[likely]] {
+                    res += chunk.count;
+                    next_pos = chunk.next_pos;
+                    continue;
+                }
+
+                const view_type searched{ searched_view(chunk.last) };
+                size_type pos{ searched.find(sub, next_pos) };
+                size_type chunk_pos{ searched.find(sub, chunk.first) };
+                size_type skipped_count{ 0 };   // i.e. the count of occurrences of the chunk chain before pos
+                while (pos != view_type::npos) {
+                    while (chunk_pos < pos) {
+                        chunk_pos = searched.find(sub, chunk_pos + sub_size);
+                        ++skipped_count;
+                    }
+                    if (chunk_pos == pos)
+                        break;
+                    ++res;
+                    next_pos = pos + sub_size;
+                    pos = searched.find(sub, next_pos);
+                }
+                if (pos != view_type::npos) {
+                    res += chunk.count - skipped_count;
+                    next_pos = chunk.next_pos;
+                }
+            }
+
+            return res;
+        }
+
+        /** \brief Returns the lowest index of sub in this string, or npos if not found, as searched on several threads. With any_one set, returns the index of any of the occurrences of sub instead.
+        *
+        * Chunks get searched block after block, the lowest index found so far
+        * being shared by all threads, which stop once it is lower than their
+        * current block, or once it is set when any_one is true.
+        */
+        [[nodiscard]]
+        size_type _parallel_find(const std::basic_string_view<CharT, TraitsT> sub, const size_type threads_count, const bool any_one) const
+        {
+            using view_type = std::basic_string_view<CharT, TraitsT>;
+            const view_type this_view(*this);
+            const size_type sub_size{ sub.size() };
+            std::atomic<size_type> found_pos{ CppStringT::npos };
+
+            parallel_for_chunks(this_view.size(), parallel_chunks_count(this_view.size(), threads_count, PARALLEL_MIN_CHARS), [&](const size_type, const size_type first, const size_type last) {
+                for (size_type block = first; block < last; block += PARALLEL_MIN_CHARS) {
+                    const size_type found{ found_pos.load(std::memory_order_relaxed) };
+                    if (found < block || (any_one && found != CppStringT::npos))
+                        return;
+
+                    const size_type block_last{ std::min(block + PARALLEL_MIN_CHARS, last) };
+                    const size_type pos{ this_view.substr(0, std::min(block_last + sub_size - 1, this_view.size())).find(sub, block) };
+                    if (pos != view_type::npos) {
+                        size_type lowest{ found_pos.load(std::memory_order_relaxed) };
+                        while (pos < lowest && !found_pos.compare_exchange_weak(lowest, pos, std::memory_order_relaxed));
+                        return;
+                    }
+                }
+            });
+
+            return found_pos.load();
+        }
+
+
+        //---   parallel splits   -----------------------------
+        /** \brief Returns the positions of the non-overlapping occurrences of sep in this string, as searched from left to right, the search running on several threads.
+        *
+        * Each chunk of the string gets all the occurrences that start in it,
+        * chained from its first occurrence.  When an occurrence straddles
+        * the next chunk, the chain of this chunk is searched again from the
+        * end of this occurrence up to the first occurrence that both chains
+        * share, from which they are the same.
+        */
+        [[nodiscard]]
+        std::vector<size_type> _parallel_find_all(const std::basic_string_view<CharT, TraitsT> sep, const size_type threads_count) const
+        {
+            using view_type = std::basic_string_view<CharT, TraitsT>;
+            const view_type this_view(*this);
+            const size_type sep_size{ sep.size() };
+            std::vector<size_type> res{};
+            if (sep_size == 0) [[unlikely]]
+                return res;
+
+            const size_type chunks_count{ parallel_chunks_count(this_view.size(), threads_count, PARALLEL_MIN_CHARS) };
+            std::vector<std::vector<size_type>> chunks_found(chunks_count);
+            std::vector<size_type> chunks_first(chunks_count);
+            std::vector<size_type> chunks_last(chunks_count);
+
+            parallel_for_chunks(this_view.size(), chunks_count, [&](const size_type chunk, const size_type first, const size_type last) {
+                chunks_first[chunk] = first;
+                chunks_last[chunk] = last;
+                const view_type searched{ this_view.substr(0, std::min(last + sep_size - 1, this_view.size())) };
+                for (size_type pos = first; (pos = searched.find(sep, pos)) != view_type::npos; pos += sep_size)
+                    chunks_found[chunk].push_back(pos);
+            });
+
+            size_type found_count{ 0 };
+            for (const auto& found : chunks_found)
+                found_count += found.size();
+            res.reserve(found_count);
+
+            size_type next_pos{ 0 };    // i.e. the position just after the last merged occurrence
+            for (size_type chunk = 0; chunk < chunks_count; ++chunk) {
+                const std::vector<size_type>& found{ chunks_found[chunk] };
+                auto it{ found.cbegin() };
+                if (next_pos > chunks_first[chunk]) [[unlikely]] {
+                    const view_type searched{ this_view.substr(0, std::min(chunks_last[chunk] + sep_size - 1, this_view.size())) };
+                    size_type pos{ next_pos };
+                    while ((pos = searched.find(sep, pos)) != view_type::npos && !std::binary_search(found.cbegin(), found.cend(), pos)) {
+                        res.push_back(pos);
+                        pos += sep_size;
+                    }
+                    it = (pos == view_type::npos) ? found.cend() : std::lower_bound(found.cbegin(), found.cend(), pos);
+                }
+                res.insert(res.end(), it, found.cend());
+                if (!res.empty())
+                    next_pos = res.back() + sep_size;
+            }
+
+            return res;
+        }
+
+        /** \brief Returns the start positions of the lines of this string, followed by the end position of its last line, line breaks being searched on several threads. */
+        [[nodiscard]]
+        std::vector<size_type> _parallel_lines_bounds(const size_type threads_count) const
+        {
+            const CharT* const chars{ this->data() };
+            const size_type size{ this->size() };
+            const size_type chunks_count{ parallel_chunks_count(size, threads_count, PARALLEL_MIN_CHARS) };
+            std::vector<std::vector<size_type>> chunks_starts(chunks_count);
+
+            parallel_for_chunks(size, chunks_count, [&](const size_type chunk, size_type first, const size_type last) {
+                if (first > 0 && chars[first - 1] == value_type('\r') && chars[first] == value_type('\n')) [[unlikely]]
+                    ++first;    // this "\r\n" belongs to the previous chunk
+                for (size_type index = first; index < last; ++index) {
+                    if (_is_line_break(chars[index])) [[unlikely]] {
+                        if (chars[index] == value_type('\r') && index + 1 < size && chars[index + 1] == value_type('\n'))
+                            ++index;
+                        chunks_starts[chunk].push_back(index + 1);
+                    }
+                }
+            });
+
+            std::vector<size_type> res{ 0 };
+            for (const auto& starts : chunks_starts)
+                res.insert(res.end(), starts.cbegin(), starts.cend());
+            if (res.back() < size) [[likely]]
+                res.push_back(size);
+            return res;
+        }
+
+        /** \brief Returns a function that returns the view on the index-th line delimited by bounds, as returned by _parallel_lines_bounds(). */
+        [[nodiscard]]
+        inline auto _lines_getter(const std::vector<size_type>& bounds, const bool keep_end) const noexcept
+        {
+            return [this, &bounds, keep_end](const size_type index) {
+                const CharT* const chars{ this->data() };
+                const size_type start{ bounds[index] };
+                size_type stop{ bounds[index + 1] };
+                if (!keep_end && _is_line_break(chars[stop - 1])) {
+                    --stop;
+                    if (chars[stop] == value_type('\n') && stop > start && chars[stop - 1] == value_type('\r'))
+                        --stop;
+                }
+                return std::basic_string_view<CharT, TraitsT>(chars + start, stop - start);
+            };
+        }
+
+        /** \brief Returns a function that returns the view on the index-th word delimited by the separators at positions seps_pos, as returned by _parallel_find_all(). */
+        [[nodiscard]]
+        inline auto _words_getter(const std::vector<size_type>& seps_pos, const size_type sep_size) const noexcept
+        {
+            return [this, &seps_pos, sep_size](const size_type index) {
+                const size_type start{ index == 0 ? 0 : seps_pos[index - 1] + sep_size };
+                const size_type stop{ index < seps_pos.size() ? seps_pos[index] : this->size() };
+                return std::basic_string_view<CharT, TraitsT>(this->data() + start, stop - start);
+            };
+        }
+
+        /** \brief Returns a vector of count strings, the index-th one being assigned in parallel with the view returned by get_view(index). */
+        template<class GetViewT>
+        [[nodiscard]]
+        static std::vector<CppStringT> _parallel_strings(const size_type count, GetViewT&& get_view, const size_type threads_count)
+        {
+            std::vector<CppStringT> res(count);
+            parallel_for_chunks(count, parallel_chunks_count(count, threads_count, PARALLEL_MIN_ITEMS), [&](const size_type, const size_type first, const size_type last) {
+                for (size_type index = first; index < last; ++index)
+                    res[index].assign(get_view(index));
+            });
+            return res;
+        }
+
+    };
+
+
+    //=====   litteral operators   ============================
+    /** \brief  Forms a CppString literal. */
+    inline CppString operator""_cs(const char* str, std::size_t len)
+    {
+        return CppString(CppString::MyBaseClass(str, len));
+    }
+
+    /** \brief Forms a CppWString literal. */
+    inline CppWString operator""_cs(const wchar_t* str, std::size_t len)
+    {
+        return CppWString(CppWString::MyBaseClass(str, len));
+    }
+
+
+    //=====   Slices   ========================================
+    //---   slices base   -------------------------------------
+    /** \brief Base class for slices, with start, stop and step specified values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    class Slice
+    {
+    public:
+        static constexpr IntT DEFAULT{ std::numeric_limits<IntT>::min() };
+
+        //---   Constructors / Destructor   -------------------
         Slice(const IntT start = DEFAULT, const IntT stop = DEFAULT, const IntT step = DEFAULT) noexcept   //!< Valued constructor
             : _start(start)
             , _stop(stop)
@@ -2028,134 +4525,4077 @@ namespace pcs // i.e. "pythonic c++ strings"
                     _start = str_size - 1;
             }
 
-            if (_stop == DEFAULT) {
-                if (_step < 0 && _step != DEFAULT) [[unlikely]]
-                    _stop = 0;
-                else
-                    _stop = str_size;
-            }
-            else if (_stop < 0) {
-                _stop += str_size;
-                if (_stop < 0)
-                    _stop = 0;
+            if (_stop == DEFAULT) {
+                if (_step < 0 && _step != DEFAULT) [[unlikely]]
+                    _stop = 0;
+                else
+                    _stop = str_size;
+            }
+            else if (_stop < 0) {
+                _stop += str_size;
+                if (_stop < 0)
+                    _stop = 0;
+            }
+            else if (_stop > str_size)
+                _stop = str_size;
+
+            if (_step == DEFAULT) [[likely]]
+                _step = 1;
+            if (_step < 0) [[unlikely]] {
+                if (_start <= _stop)
+                    _step = 0;  // will force end() to true
+            }
+            else [[unlikely]] {
+                if (_start >= _stop)
+                    _step = 0;  // will force end() to true
+            }
+
+            return _index = _start;
+        }
+    };
+
+
+    /** \brief Class of slices with default stop and step values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    struct StartSlice : public Slice<IntT>
+    {
+        using MyBaseClass = Slice<IntT>;
+
+        //---   Constructors / Destructor   -------------------
+        inline StartSlice(const IntT start = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
+            : MyBaseClass(start, MyBaseClass::DEFAULT, 1)
+        {}
+
+        virtual ~StartSlice() noexcept = default;  //!< Default destructor.
+    };
+
+
+    /** \brief Class of slices with default start and step values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    struct StopSlice : public Slice<IntT>
+    {
+        using MyBaseClass = Slice<IntT>;
+
+        //---   Constructors / Destructor   -------------------
+        inline StopSlice(const IntT stop = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
+            : MyBaseClass(MyBaseClass::DEFAULT, stop, 1)
+        {}
+
+        virtual ~StopSlice() noexcept = default;  //!< Default destructor.
+    };
+
+
+    /** \brief Class of slices with default start and stop values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    struct StepSlice : public Slice<IntT>
+    {
+        using MyBaseClass = Slice<IntT>;
+
+        //---   Constructors / Destructor   -------------------
+        inline StepSlice(const IntT step = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
+            : MyBaseClass(MyBaseClass::DEFAULT, MyBaseClass::DEFAULT, step)
+        {}
+
+        virtual ~StepSlice() noexcept = default;  //!< Default destructor.
+    };
+
+
+    /** \brief Class of slices with default step values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    struct StartStopSlice : public Slice<IntT>
+    {
+        using MyBaseClass = Slice<IntT>;
+
+        //---   Constructors / Destructor   -------------------
+        inline StartStopSlice(const IntT start = MyBaseClass::DEFAULT, const IntT stop = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
+            : MyBaseClass(start, stop, 1)
+        {}
+
+        virtual ~StartStopSlice() noexcept = default;  //!< Default destructor.
+    };
+
+
+    /** \brief Class of slices with default stop values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    struct StartStepSlice : public Slice<IntT>
+    {
+        using MyBaseClass = Slice<IntT>;
+
+        //---   Constructors / Destructor   -------------------
+        inline StartStepSlice(const IntT start = MyBaseClass::DEFAULT, const IntT step = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
+            : MyBaseClass(start, MyBaseClass::DEFAULT, step)
+        {}
+
+        virtual ~StartStepSlice() noexcept = default;  //!< Default destructor.
+
+    };
+
+
+    /** \brief Class of slices with default start values. */
+    template<typename IntT>
+        requires std::is_signed_v<IntT>
+    struct StopStepSlice : public Slice<IntT>
+    {
+        using MyBaseClass = Slice<IntT>;
+
+        //---   Constructors / Destructor   -------------------
+        inline StopStepSlice(const IntT stop = MyBaseClass::DEFAULT, const IntT step = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
+            : MyBaseClass(MyBaseClass::DEFAULT, stop, step)
+        {}
+
+        virtual ~StopStepSlice() noexcept = default;  //!< Default destructor.
+    };
+
+
+    //=====   Characters sets   ===================================
+    /** \brief The class of sets of characters, backed by bitmaps.
+    *
+    * Membership tests run in constant time, whatever the count of
+    * characters in the set. Characters with codes less than 256 are stored
+    * in one 256-bits bitmap and get tested with one single bit test. Wider
+    * characters are stored in a two-levels table: a directory, directly
+    * indexed by the high part of the characters codes, gives the 256-bits
+    * page of each character, pages being allocated for the non-empty ones
+    * only. Tests of wide characters thus cost two indexed loads. Codes
+    * beyond the Unicode range, which only 32-bits characters may hold, are
+    * kept in a sorted vector instead, to bound the size of the directory.
+    */
+    template<class CharT>
+    class CharSetT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using size_type = std::size_t;
+
+
+        //---   Constructors / Destructor   -------------------
+        inline CharSetT() noexcept = default;                   //!< Default constructor, empty set
+
+        /** \brief Constructor with a list of characters. */
+        inline CharSetT(std::initializer_list<CharT> chars)
+        {
+            for (const CharT ch : chars)
+                add(ch);
+        }
+
+        /** \brief Constructor with the characters of a null-terminated string. */
+        inline explicit CharSetT(const CharT* chars)
+        {
+            if (chars != nullptr) [[likely]]
+                add(std::basic_string_view<CharT>(chars));
+        }
+
+        /** \brief Constructor with the characters of a string view. */
+        template<class TraitsT>
+        inline explicit CharSetT(const std::basic_string_view<CharT, TraitsT> chars)
+        {
+            add(chars);
+        }
+
+        /** \brief Constructor with the characters of a string. */
+        template<class TraitsT, class AllocatorT>
+        inline explicit CharSetT(const std::basic_string<CharT, TraitsT, AllocatorT>& chars)
+        {
+            add(std::basic_string_view<CharT, TraitsT>(chars));
+        }
+
+
+        //---   whitespaces()   -----------------------------
+        /** \brief Returns the set of the characters that Python considers as whitespaces.
+        *
+        * These are the ASCII whitespaces  and  separators,  plus  the
+        * Unicode ones when the characters type is wide enough for them.
+        */
+        [[nodiscard]]
+        static CharSetT whitespaces()
+        {
+            CharSetT res{ CharT(' '), CharT('\t'), CharT('\n'), CharT('\r'), CharT('\v'), CharT('\f'),
+                          CharT(0x1c), CharT(0x1d), CharT(0x1e), CharT(0x1f) };
+            if constexpr (sizeof(CharT) > 1) {
+                for (const unsigned int code : { 0x85u, 0xa0u, 0x1680u, 0x2028u, 0x2029u, 0x202fu, 0x205fu, 0x3000u })
+                    res.add(CharT(code));
+                for (unsigned int code = 0x2000u; code <= 0x200au; ++code)
+                    res.add(CharT(code));
+            }
+            return res;
+        }
+
+
+        //---   modifiers   -----------------------------------
+        /** \brief Adds character ch to this set. Returns a reference to this set. */
+        CharSetT& add(const CharT ch)
+        {
+            const code_type code{ _code(ch) };
+            if (code < PAGE_SIZE) [[likely]] {
+                _set(m_low_page, code);
+            }
+            else if (code > MAX_DIRECT_CODE) [[unlikely]] {
+                const auto it{ std::ranges::lower_bound(m_beyond_codes, code) };
+                if (it == m_beyond_codes.end() || *it != code)
+                    m_beyond_codes.insert(it, code);
+            }
+            else [[unlikely]] {
+                const size_type page_index{ code / PAGE_SIZE };
+                if (page_index >= m_directory.size())
+                    m_directory.resize(page_index + 1, 0);
+                if (m_directory[page_index] == 0) {
+                    m_high_pages.push_back(page_type{});
+                    m_directory[page_index] = std::uint32_t(m_high_pages.size());
+                }
+                _set(m_high_pages[m_directory[page_index] - 1], code % PAGE_SIZE);
+            }
+            return *this;
+        }
+
+        /** \brief Adds all the characters of chars to this set. Returns a reference to this set. */
+        template<class TraitsT>
+        CharSetT& add(const std::basic_string_view<CharT, TraitsT> chars)
+        {
+            for (const CharT ch : chars)
+                add(ch);
+            return *this;
+        }
+
+        /** \brief Removes character ch from this set. Returns a reference to this set. */
+        CharSetT& remove(const CharT ch) noexcept
+        {
+            const code_type code{ _code(ch) };
+            if (code < PAGE_SIZE) [[likely]] {
+                m_low_page[code / 64] &= ~(std::uint64_t(1) << (code % 64));
+            }
+            else if (code > MAX_DIRECT_CODE) [[unlikely]] {
+                const auto it{ std::ranges::lower_bound(m_beyond_codes, code) };
+                if (it != m_beyond_codes.end() && *it == code)
+                    m_beyond_codes.erase(it);
+            }
+            else if (const size_type page_index{ code / PAGE_SIZE }; page_index < m_directory.size() && m_directory[page_index] != 0) [[unlikely]] {
+                m_high_pages[m_directory[page_index] - 1][(code % PAGE_SIZE) / 64] &= ~(std::uint64_t(1) << (code % 64));
+            }
+            return *this;
+        }
+
+
+        //---   membership   ----------------------------------
+        /** \brief Returns true if character ch is in this set, or false otherwise. */
+        [[nodiscard]]
+        inline bool contains(const CharT ch) const noexcept
+        {
+            const code_type code{ _code(ch) };
+            if constexpr (sizeof(CharT) == 1) {
+                return _test(m_low_page, code);
+            }
+            else {
+                if (code < PAGE_SIZE) [[likely]]
+                    return _test(m_low_page, code);
+                if (code > MAX_DIRECT_CODE) [[unlikely]]
+                    return std::ranges::binary_search(m_beyond_codes, code);
+                const size_type page_index{ code / PAGE_SIZE };
+                return page_index < m_directory.size() && m_directory[page_index] != 0 &&
+                       _test(m_high_pages[m_directory[page_index] - 1], code % PAGE_SIZE);
+            }
+        }
+
+        /** \brief Same as contains(), so that sets can be used as predicates. */
+        [[nodiscard]]
+        inline bool operator() (const CharT ch) const noexcept
+        {
+            return contains(ch);
+        }
+
+        /** \brief Returns true if this set contains no character, or false otherwise. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return std::ranges::all_of(m_low_page, [](const std::uint64_t bits) { return bits == 0; }) &&
+                   m_beyond_codes.empty() &&
+                   std::ranges::all_of(m_high_pages, [](const page_type& page) { return std::ranges::all_of(page, [](const std::uint64_t bits) { return bits == 0; }); });
+        }
+
+
+    private:
+        using code_type = std::conditional_t<(sizeof(CharT) < sizeof(std::uint32_t)), std::uint32_t, std::make_unsigned_t<CharT>>;
+        using page_type = std::array<std::uint64_t, 4>;
+
+        static constexpr code_type PAGE_SIZE{ 256 };
+        static constexpr code_type MAX_DIRECT_CODE{ 0x10ffff };
+
+        page_type m_low_page{};
+        std::vector<std::uint32_t> m_directory{};   // indexed by code / PAGE_SIZE: 1 + index of the page in m_high_pages, or 0 for empty pages
+        std::vector<page_type> m_high_pages{};
+        std::vector<code_type> m_beyond_codes{};    // sorted codes beyond MAX_DIRECT_CODE
+
+        [[nodiscard]]
+        static inline code_type _code(const CharT ch) noexcept
+        {
+            return code_type(static_cast<std::make_unsigned_t<CharT>>(ch));
+        }
+
+        static inline void _set(page_type& page, const code_type code) noexcept
+        {
+            page[code / 64] |= std::uint64_t(1) << (code % 64);
+        }
+
+        [[nodiscard]]
+        static inline bool _test(const page_type& page, const code_type code) noexcept
+        {
+            return (page[code / 64] >> (code % 64)) & 1;
+        }
+    };
+
+
+    //=====   Bounded outputs   ===================================
+    /** \brief The class of outputs of characters into a caller-provided span.
+    *
+    * Characters are output via the output iterator returned by begin().
+    * At most dest.size() characters get written into the span, the next
+    * ones being dropped.  All the output characters get counted however,
+    * so that count() returns the length of the whole output, which tells
+    * the caller the size of the buffer that would have been needed.
+    */
+    template<class CharT>
+    class BoundedOutputT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using size_type = std::size_t;
+
+        /** \brief The output iterator over a bounded output. */
+        class iterator
+        {
+        public:
+            using iterator_category = std::output_iterator_tag;
+            using value_type        = void;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = void;
+            using reference         = void;
+
+            inline iterator() noexcept = default;
+            inline explicit iterator(BoundedOutputT* output) noexcept
+                : m_output{ output }
+            {}
+
+            inline const iterator& operator= (const CharT ch) const noexcept
+            {
+                if (m_output->m_count < m_output->m_dest.size()) [[likely]]
+                    m_output->m_dest[m_output->m_count] = ch;
+                ++m_output->m_count;
+                return *this;
+            }
+
+            inline const iterator& operator* () const noexcept { return *this; }
+            inline iterator& operator++ () noexcept { return *this; }
+            inline iterator operator++ (int) noexcept { return *this; }
+
+        private:
+            BoundedOutputT* m_output{ nullptr };
+        };
+
+
+        //---   Constructors / Destructor   -------------------
+        inline explicit BoundedOutputT(std::span<CharT> dest) noexcept  //!< Valued constructor
+            : m_dest{ dest }
+        {}
+
+        BoundedOutputT(const BoundedOutputT&) = delete;     // iterators point to their output, which then cannot be copied nor moved
+        BoundedOutputT(BoundedOutputT&&) = delete;
+
+
+        //---   properties   ----------------------------------
+        /** \brief Returns an output iterator to this bounded output. */
+        [[nodiscard]]
+        inline iterator begin() noexcept
+        {
+            return iterator(this);
+        }
+
+        /** \brief Returns the count of characters that have been output, whether they have been written or dropped. */
+        [[nodiscard]]
+        inline size_type count() const noexcept
+        {
+            return m_count;
+        }
+
+        /** \brief Returns a pointer to the first character of the span. */
+        [[nodiscard]]
+        inline CharT* data() const noexcept
+        {
+            return m_dest.data();
+        }
+
+        /** \brief Returns the size of the span. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_dest.size();
+        }
+
+        /** \brief Returns true if some output characters have been dropped, or false otherwise. */
+        [[nodiscard]]
+        inline bool truncated() const noexcept
+        {
+            return m_count > m_dest.size();
+        }
+
+        /** \brief Returns the count of characters that have been written into the span. */
+        [[nodiscard]]
+        inline size_type written() const noexcept
+        {
+            return std::min(m_count, m_dest.size());
+        }
+
+
+    private:
+        std::span<CharT> m_dest;
+        size_type m_count{ 0 };
+    };
+
+
+    //=====   Reverse splits views   ==============================
+    /** \brief The class of lazy views of the words of a string, from the rightmost one to the leftmost one.
+    *
+    * The string is scanned backwards once, one separator after the other,
+    * as iterations go on. Words are string views  on  the  viewed  string,
+    * which then must outlive the view.  At most maxsplit splits are done,
+    * the rightmost ones, so that the last iterated word is the remaining
+    * leftmost part of the string.
+    */
+    template<class CharT, class TraitsT>
+    class RSplitViewT : public std::ranges::view_interface<RSplitViewT<CharT, TraitsT>>
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using size_type = std::size_t;
+        using view_type = std::basic_string_view<CharT, TraitsT>;
+
+        /** \brief The forward iterator over the words of a reverse split view. */
+        class iterator
+        {
+        public:
+            using iterator_category = std::forward_iterator_tag;
+            using value_type        = view_type;
+            using difference_type   = std::ptrdiff_t;
+            using pointer           = const view_type*;
+            using reference         = view_type;
+
+            inline iterator() noexcept = default;
+            inline iterator(const view_type str, const view_type sep, const size_type maxsplit) noexcept
+                : m_str{ str }
+                , m_sep{ sep }
+                , m_end{ str.size() }
+                , m_splits_left{ maxsplit }
+            {
+                _next();
+            }
+
+            [[nodiscard]]
+            inline view_type operator* () const noexcept
+            {
+                return m_word;
+            }
+
+            inline iterator& operator++ () noexcept
+            {
+                _next();
+                return *this;
+            }
+
+            inline iterator operator++ (int) noexcept
+            {
+                iterator tmp{ *this };
+                _next();
+                return tmp;
+            }
+
+            [[nodiscard]]
+            inline bool operator== (const iterator& other) const noexcept
+            {
+                return m_done == other.m_done && (m_done || (m_word.data() == other.m_word.data() && m_word.size() == other.m_word.size()));
+            }
+
+            [[nodiscard]]
+            inline bool operator== (std::default_sentinel_t) const noexcept
+            {
+                return m_done;
+            }
+
+        private:
+            view_type m_str{};
+            view_type m_sep{};
+            view_type m_word{};
+            size_type m_end{ 0 };           // end of the not yet split leftmost part of the string
+            size_type m_splits_left{ 0 };
+            bool      m_last{ false };      // true once the leftmost word has been reached
+            bool      m_done{ true };
+
+            /** \brief Evaluates the next word, from right to left. */
+            inline void _next() noexcept
+            {
+                if (m_last) [[unlikely]] {
+                    m_done = true;
+                    return;
+                }
+                m_done = false;
+
+                const size_type sep_size{ m_sep.size() };
+                if (m_splits_left > 0 && sep_size > 0 && m_end >= sep_size) [[likely]] {
+                    const size_type index{ m_str.rfind(m_sep, m_end - sep_size) };
+                    if (index != view_type::npos) [[likely]] {
+                        m_word = m_str.substr(index + sep_size, m_end - index - sep_size);
+                        m_end = index;
+                        --m_splits_left;
+                        return;
+                    }
+                }
+
+                m_word = m_str.substr(0, m_end);
+                m_last = true;
+            }
+        };
+
+
+        //---   Constructors / Destructor   -------------------
+        inline RSplitViewT() noexcept = default;                                                                   //!< Default constructor
+        inline RSplitViewT(const view_type str, const view_type sep, const size_type maxsplit = size_type(-1)) noexcept  //!< Valued constructor
+            : m_str{ str }
+            , m_sep{ sep }
+            , m_maxsplit{ maxsplit }
+        {}
+
+
+        //---   iterating   -----------------------------------
+        /** \brief Returns an iterator to the rightmost word of the string. */
+        [[nodiscard]]
+        inline iterator begin() const noexcept
+        {
+            return iterator(m_str, m_sep, m_maxsplit);
+        }
+
+        /** \brief Returns the sentinel that ends the iterations. */
+        [[nodiscard]]
+        inline std::default_sentinel_t end() const noexcept
+        {
+            return std::default_sentinel;
+        }
+
+
+    private:
+        view_type m_str{};
+        view_type m_sep{};
+        size_type m_maxsplit{ size_type(-1) };
+    };
+
+
+    //=====   Split buffers   =====================================
+    /** \brief The class of reusable buffers of the words of split strings.
+    *
+    * Filled by methods CppStringT::split_into() and splitlines_into().  The
+    * buffer keeps a high-water mark of strings that is distinct  from  its
+    * logical size: clearing or refilling it with fewer words keeps all the
+    * strings alive, with their capacities, so that the next calls reuse
+    * them. Once a buffer has grown enough, splitting thus allocates no
+    * memory at all. Only the first size() strings are valid words.
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    class SplitBufferT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using string_type     = CppStringT<CharT, TraitsT, AllocatorT>;
+        using vector_type     = std::vector<string_type>;
+        using size_type       = std::size_t;
+        using iterator        = typename vector_type::iterator;
+        using const_iterator  = typename vector_type::const_iterator;
+
+
+        //---   Constructors / Destructor   -------------------
+        inline SplitBufferT() noexcept = default;               //!< Default constructor, empty buffer
+
+
+        //---   accessors   -----------------------------------
+        /** \brief Returns the count of words in this buffer. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_size;
+        }
+
+        /** \brief Returns true if this buffer contains no word, or false otherwise. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+        /** \brief Returns the count of strings kept alive by this buffer, i.e. its high-water mark. */
+        [[nodiscard]]
+        inline size_type capacity() const noexcept
+        {
+            return m_words.size();
+        }
+
+        /** \brief Returns the index-th word of this buffer. */
+        [[nodiscard]]
+        inline string_type& operator[] (const size_type index) noexcept
+        {
+            return m_words[index];
+        }
+
+        /** \brief Returns the index-th word of this buffer. */
+        [[nodiscard]]
+        inline const string_type& operator[] (const size_type index) const noexcept
+        {
+            return m_words[index];
+        }
+
+
+        //---   iterating   -----------------------------------
+        [[nodiscard]] inline iterator begin() noexcept { return m_words.begin(); }                                        //!< Returns an iterator to the first word
+        [[nodiscard]] inline iterator end() noexcept { return m_words.begin() + m_size; }                                 //!< Returns an iterator past the last word
+        [[nodiscard]] inline const_iterator begin() const noexcept { return m_words.cbegin(); }                           //!< Returns an iterator to the first word
+        [[nodiscard]] inline const_iterator end() const noexcept { return m_words.cbegin() + m_size; }                    //!< Returns an iterator past the last word
+
+
+        //---   modifiers   -----------------------------------
+        /** \brief Empties this buffer, keeping all its strings alive for the next words. */
+        inline void clear() noexcept
+        {
+            m_size = 0;
+        }
+
+        /** \brief Appends the count characters at first as the next word, overwriting in place the next kept alive string if any. */
+        void push_back(const CharT* first, const size_type count)
+        {
+            if (m_size < m_words.size()) [[likely]]
+                m_words[m_size].assign(first, count);
+            else [[unlikely]]
+                m_words.emplace_back(first, count);
+            ++m_size;
+        }
+
+        /** \brief Reserves room for count strings. */
+        inline void reserve(const size_type count)
+        {
+            m_words.reserve(count);
+        }
+
+        /** \brief Returns the vector of the words of this buffer, moved out of it. The buffer is left empty. */
+        [[nodiscard]]
+        vector_type release() &&
+        {
+            m_words.resize(m_size);
+            m_size = 0;
+            return std::move(m_words);
+        }
+
+
+    private:
+        vector_type m_words{};
+        size_type   m_size{ 0 };
+    };
+
+
+    //=====   Interned strings   ==================================
+    //---   interned strings pools   ------------------------------
+    /** \brief The class of pools of interned strings.
+    *
+    * An interned string is stored only once in its pool, whatever the number
+    * of times it has been interned. The pool returns handles (\see CppInternedT)
+    * which are pointer-comparable: two handles are equal if and only if they
+    * refer to the same content.
+    *
+    * The pool is a hash table of buckets, each one being a singly linked
+    * list of entries. Lookups are lock-free: they only load atomic pointers,
+    * so that interning strings that are already interned writes no shared
+    * memory and scales on all threads. Only the insertions of new strings
+    * take the mutex of the pool, the table doubling its count of buckets
+    * when it gets more entries than buckets: entries get relinked into a
+    * new array of buckets, which is then published with release ordering.
+    * Lookups that run concurrently with a rehash may miss their string,
+    * they then search it again under the mutex. Entries are stored in an
+    * arena and retired arrays of buckets are kept too: none of them is
+    * freed until the destruction of the pool.
+    *
+    * Most users should not instantiate this class but rather call function
+    * pcs::intern(), which uses the global pool that is associated with each
+    * type of characters.
+    */
+    template<class CharT, class TraitsT>
+    class InternPoolT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using value_type = CharT;
+        using size_type  = std::size_t;
+        using view_type  = std::basic_string_view<CharT, TraitsT>;
+        using handle_type = CppInternedT<CharT, TraitsT>;
+
+        static constexpr size_type DEFAULT_BUCKETS_BITS{ 10 };     //!< i.e. 1,024 buckets initially per pool
+        static constexpr size_type ARENA_CHUNK_SIZE{ 64 * 1024 };  //!< size in bytes of the chunks of memory of the arena
+
+
+        //---   entries   -------------------------------------
+        /** \brief The internal storage of an interned string. Characters are stored right after the entry, null-terminated. */
+        struct Entry
+        {
+            std::atomic<Entry*> next;   //!< next entry in the same bucket, modified when rehashing only
+            std::size_t hash;   //!< the hash value of the interned content
+            size_type   size;   //!< the count of characters of the interned content
+
+            [[nodiscard]]
+            inline const CharT* data() const noexcept  //!< returns a pointer to the null-terminated interned characters
+            {
+                return reinterpret_cast<const CharT*>(this + 1);
+            }
+
+            [[nodiscard]]
+            inline view_type view() const noexcept  //!< returns a view on the interned characters
+            {
+                return view_type(data(), size);
+            }
+        };
+
+
+        //---   Constructors / Destructor   -------------------
+        /** \brief Creates an empty pool with initially 2^buckets_bits buckets. */
+        explicit InternPoolT(const size_type buckets_bits = DEFAULT_BUCKETS_BITS)
+        {
+            m_table.store(_new_table(size_type(1) << buckets_bits), std::memory_order_release);
+        }
+
+        InternPoolT(const InternPoolT&) = delete;               //!< Pools are not copyable
+        InternPoolT(InternPoolT&&) = delete;                    //!< Pools are not movable, since handles point into them
+
+        ~InternPoolT() noexcept = default;                      //!< Default destructor. Releases all the memory of the arena.
+
+        InternPoolT& operator= (const InternPoolT&) = delete;   //!< Pools are not copyable
+        InternPoolT& operator= (InternPoolT&&) = delete;        //!< Pools are not movable
+
+
+        //---   global pool   ---------------------------------
+        /** \brief Returns a reference to the global pool associated with this type of characters. */
+        [[nodiscard]]
+        static InternPoolT& global()
+        {
+            static InternPoolT global_pool{};
+            return global_pool;
+        }
+
+
+        //---   interning   -----------------------------------
+        /** \brief Interns the passed content and returns its handle. Thread-safe.
+        *
+        * Notice: the empty string is never stored in the pool. Its handle is
+        * the default constructed one.
+        */
+        [[nodiscard]]
+        handle_type intern(const view_type str)
+        {
+            if (str.empty()) [[unlikely]]
+                return handle_type();
+
+            const std::size_t hash{ std::hash<view_type>{}(str) };
+            if (const Entry* found = _lookup(hash, str); found != nullptr) [[likely]]
+                return handle_type(found);  // lock-free hit
+
+            std::unique_lock<std::mutex> lock(m_mutex);
+            if (const Entry* found = _lookup(hash, str); found != nullptr) [[unlikely]]
+                return handle_type(found);  // some other thread has interned str meanwhile, or a rehash hid it
+
+            Entry* entry{ _new_entry(str, hash) };
+            const size_type count{ m_count.load(std::memory_order_relaxed) };
+            const Table* table{ m_table.load(std::memory_order_relaxed) };
+            if (count >= table->size) [[unlikely]]
+                table = _rehash(2 * table->size);
+            std::atomic<Entry*>& bucket{ table->buckets[hash & (table->size - 1)] };
+            entry->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            bucket.store(entry, std::memory_order_release);     // publishes the content of the entry
+            m_count.store(count + 1, std::memory_order_relaxed);
+            return handle_type(entry);
+        }
+
+
+        //---   properties   ----------------------------------
+        /** \brief Returns the current count of buckets of this pool. */
+        [[nodiscard]]
+        inline size_type buckets_count() const noexcept
+        {
+            return m_table.load(std::memory_order_acquire)->size;
+        }
+
+        /** \brief Returns the count of bytes allocated for the arena of this pool, buckets excluded. */
+        [[nodiscard]]
+        inline size_type memory_usage() const
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            return m_arena_bytes;
+        }
+
+        /** \brief Returns the count of distinct strings interned in this pool. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_count.load(std::memory_order_relaxed);
+        }
+
+
+    private:
+        /** \brief An array of a power of 2 count of buckets. */
+        struct Table
+        {
+            size_type size;
+            std::unique_ptr<std::atomic<Entry*>[]> buckets;
+        };
+
+        mutable std::mutex m_mutex{};                           //!< taken by insertions only
+        std::atomic<const Table*> m_table{ nullptr };           //!< the current array of buckets
+        std::vector<std::unique_ptr<Table>> m_tables{};         //!< all the arrays of buckets, retired ones included
+        std::atomic<size_type> m_count{ 0 };
+
+        std::vector<std::unique_ptr<std::byte[]>> m_arena_chunks{};
+        std::byte* m_arena_ptr{ nullptr };
+        size_type m_arena_left{ 0 };
+        size_type m_arena_bytes{ 0 };
+
+        /** \brief Searches for str in its bucket, lock-free. May miss str when a rehash is running. */
+        [[nodiscard]]
+        const Entry* _lookup(const std::size_t hash, const view_type str) const noexcept
+        {
+            const Table* const table{ m_table.load(std::memory_order_acquire) };
+            for (const Entry* e = table->buckets[hash & (table->size - 1)].load(std::memory_order_acquire); e != nullptr; e = e->next.load(std::memory_order_acquire))
+                if (e->hash == hash && e->view() == str)
+                    return e;
+            return nullptr;
+        }
+
+        /** \brief Allocates a new empty array of buckets_count buckets, kept up to the destruction of the pool. The mutex of the pool must be held, but by the constructor. */
+        [[nodiscard]]
+        Table* _new_table(const size_type buckets_count)
+        {
+            m_tables.push_back(std::make_unique<Table>(Table{ buckets_count, std::make_unique<std::atomic<Entry*>[]>(buckets_count) }));
+            return m_tables.back().get();
+        }
+
+        /** \brief Relinks all the entries into a new array of buckets_count buckets, then publishes it. Returns the new array. The mutex of the pool must be held.
+        *
+        * Lookups running concurrently keep on walking the retired array. The
+        * relinked entries lead them into the lists of the new array, so that
+        * they may miss their string, but never loop nor return a wrong entry.
+        */
+        const Table* _rehash(const size_type buckets_count)
+        {
+            Table* const table{ _new_table(buckets_count) };
+            const Table* const old_table{ m_table.load(std::memory_order_relaxed) };
+            for (size_type index = 0; index < old_table->size; ++index) {
+                Entry* head{ old_table->buckets[index].load(std::memory_order_relaxed) };
+                while (head != nullptr) {
+                    Entry* const next{ head->next.load(std::memory_order_relaxed) };
+                    std::atomic<Entry*>& bucket{ table->buckets[head->hash & (buckets_count - 1)] };
+                    head->next.store(bucket.load(std::memory_order_relaxed), std::memory_order_release);
+                    bucket.store(head, std::memory_order_relaxed);
+                    head = next;
+                }
+            }
+            m_table.store(table, std::memory_order_release);
+            return table;
+        }
+
+        /** \brief Allocates a new entry in the arena and copies str into it. The mutex of the pool must be held. */
+        [[nodiscard]]
+        Entry* _new_entry(const view_type str, const std::size_t hash)
+        {
+            constexpr size_type align{ alignof(Entry) };
+            const size_type bytes{ (sizeof(Entry) + (str.size() + 1) * sizeof(CharT) + align - 1) / align * align };
+
+            std::byte* mem{ nullptr };
+            if (bytes > m_arena_left) [[unlikely]] {
+                const size_type chunk_size{ std::max(bytes, ARENA_CHUNK_SIZE) };
+                m_arena_chunks.push_back(std::make_unique<std::byte[]>(chunk_size));
+                m_arena_bytes += chunk_size;
+                if (chunk_size == ARENA_CHUNK_SIZE) [[likely]] {
+                    m_arena_ptr = m_arena_chunks.back().get();
+                    m_arena_left = chunk_size;
+                }
+                else [[unlikely]] {
+                    // big strings get their own chunk, the current one remains in use
+                    mem = m_arena_chunks.back().get();
+                }
+            }
+            if (mem == nullptr) [[likely]] {
+                mem = m_arena_ptr;
+                m_arena_ptr += bytes;
+                m_arena_left -= bytes;
+            }
+
+            Entry* entry{ ::new (mem) Entry{ nullptr, hash, str.size() } };
+            CharT* chars{ reinterpret_cast<CharT*>(entry + 1) };
+            TraitsT::copy(chars, str.data(), str.size());
+            chars[str.size()] = CharT(0);
+            return entry;
+        }
+    };
+
+
+    //---   interned strings handles   ----------------------------
+    /** \brief The class of handles to interned strings.
+    *
+    * Handles are cheap to copy and are pointer-comparable: two handles that
+    * have been returned by the same pool are equal if and only if they refer
+    * to the same content. They remain valid as long as their pool exists; the
+    * global pools exist up to the end of the program.
+    *
+    * The default constructed handle refers to the empty string.
+    * \see function pcs::intern().
+    */
+    template<class CharT, class TraitsT>
+    class CppInternedT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using value_type = CharT;
+        using size_type  = std::size_t;
+        using view_type  = std::basic_string_view<CharT, TraitsT>;
+        using entry_type = typename InternPoolT<CharT, TraitsT>::Entry;
+
+        //---   Constructors / Destructor   -------------------
+        inline CppInternedT() noexcept = default;                           //!< Default constructor, the empty string.
+        inline CppInternedT(const CppInternedT&) noexcept = default;        //!< Default copy constructor.
+        inline explicit CppInternedT(const entry_type* entry) noexcept      //!< Valued constructor, as used by pools.
+            : m_entry{ entry }
+        {}
+
+        inline ~CppInternedT() noexcept = default;                          //!< Default destructor.
+
+        //---   operators   -----------------------------------
+        inline CppInternedT& operator= (const CppInternedT&) noexcept = default;  //!< Default copy assignment
+
+        /** \brief Returns true if both handles refer to the same interned string. This is a pointers comparison. */
+        [[nodiscard]]
+        inline friend bool operator== (const CppInternedT& lhs, const CppInternedT& rhs) noexcept
+        {
+            return lhs.m_entry == rhs.m_entry;
+        }
+
+        /** \brief Returns true if this handle refers to content equal to str. */
+        [[nodiscard]]
+        inline bool operator== (const view_type str) const noexcept
+        {
+            return view() == str;
+        }
+
+        /** \brief Implicit conversion to a view on the interned string. */
+        [[nodiscard]]
+        inline operator view_type() const noexcept
+        {
+            return view();
+        }
+
+        //---   accessors   -----------------------------------
+        /** \brief Returns a pointer to the null-terminated interned characters. */
+        [[nodiscard]]
+        inline const CharT* c_str() const noexcept
+        {
+            static constexpr CharT empty[1]{ CharT(0) };
+            return m_entry == nullptr ? empty : m_entry->data();
+        }
+
+        /** \brief Returns true if the handle refers to the empty string. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return m_entry == nullptr;
+        }
+
+        /** \brief Returns the hash value of the interned string, as computed once when interning it. */
+        [[nodiscard]]
+        inline std::size_t hash() const noexcept
+        {
+            return m_entry == nullptr ? std::hash<view_type>{}(view_type()) : m_entry->hash;
+        }
+
+        /** \brief Returns the count of characters of the interned string. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_entry == nullptr ? 0 : m_entry->size;
+        }
+
+        /** \brief Returns a copy of the interned string as a CppStringT. */
+        [[nodiscard]]
+        inline CppStringT<CharT, TraitsT> str() const
+        {
+            return CppStringT<CharT, TraitsT>(c_str(), size());
+        }
+
+        /** \brief Returns a view on the interned string. */
+        [[nodiscard]]
+        inline view_type view() const noexcept
+        {
+            return m_entry == nullptr ? view_type() : m_entry->view();
+        }
+
+    private:
+        const entry_type* m_entry{ nullptr };
+    };
+
+
+    //---   intern()   --------------------------------------------
+    /** \brief Interns the passed string into the global pool of interned strings and returns its handle. */
+    template<class CharT, class TraitsT>
+    [[nodiscard]]
+    inline CppInternedT<CharT, TraitsT> intern(const std::basic_string_view<CharT, TraitsT> str)
+    {
+        return InternPoolT<CharT, TraitsT>::global().intern(str);
+    }
+
+    /** \brief Interns the passed string into the global pool of interned strings and returns its handle. */
+    template<class CharT, class TraitsT, class AllocatorT>
+    [[nodiscard]]
+    inline CppInternedT<CharT, TraitsT> intern(const CppStringT<CharT, TraitsT, AllocatorT>& str)
+    {
+        return InternPoolT<CharT, TraitsT>::global().intern(std::basic_string_view<CharT, TraitsT>(str));
+    }
+
+    /** \brief Interns the passed null-terminated string into the global pool of interned strings and returns its handle. */
+    template<class CharT>
+    [[nodiscard]]
+    inline CppInternedT<CharT> intern(const CharT* str)
+    {
+        return InternPoolT<CharT>::global().intern(str ? std::basic_string_view<CharT>(str) : std::basic_string_view<CharT>());
+    }
+
+
+    //=====   Ropes   =============================================
+    /** \brief The class of ropes, i.e. strings stored as balanced binary trees of chunks.
+    *
+    * Ropes are immutable. Concatenating two ropes, extracting a substring  of
+    * a rope or indexing one of its characters is done in O(log n). Nodes are
+    * shared between ropes, so copying a rope is done in O(1).  Leaves are
+    * views on immutable shared buffers: splitting a leaf creates two views
+    * on its buffer and copies no character, the buffer living as long  as
+    * any leaf still views it.
+    *
+    * Ropes are the right choice for large concatenation workloads, when big
+    * documents get built from many pieces.  Once done,  the final string is
+    * flattened with one single allocation with method str().
+    *
+    * Some pythonic methods are available on ropes: contains(), count(),
+    * find() and split(). They run over the chunks of the rope, dealing with
+    * matches that straddle consecutive chunks, without flattening it.
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    class CppRopeT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
+        using value_type  = CharT;
+        using size_type   = typename string_type::size_type;
+        using view_type   = std::basic_string_view<CharT, TraitsT>;
+
+        static constexpr size_type npos{ string_type::npos };
+        static constexpr size_type LEAF_MAX_SIZE{ 512 };    //!< consecutive chunks get merged as long as their size does not exceed this value
+
+
+        //---   Constructors / Destructor   -------------------
+        inline CppRopeT() noexcept = default;                           //!< Default constructor, the empty rope.
+        inline CppRopeT(const CppRopeT&) noexcept = default;            //!< Default copy constructor.
+        inline CppRopeT(CppRopeT&&) noexcept = default;                 //!< Default move constructor.
+
+        inline CppRopeT(const string_type& str)                         //!< Creates a one-chunk rope from a string.
+            : m_root{ _leaf(string_type(str)) }
+        {}
+
+        inline CppRopeT(string_type&& str)                              //!< Creates a one-chunk rope from a string, moving its content.
+            : m_root{ _leaf(std::move(str)) }
+        {}
+
+        inline CppRopeT(const view_type str)                            //!< Creates a one-chunk rope from a string view.
+            : m_root{ _leaf(string_type(str.data(), str.size())) }
+        {}
+
+        inline CppRopeT(const CharT* str)                               //!< Creates a one-chunk rope from a null-terminated string.
+            : m_root{ _leaf(string_type(str)) }
+        {}
+
+        inline ~CppRopeT() noexcept = default;                          //!< Default destructor.
+
+
+        //---   Assignment operators   ----------------------
+        inline CppRopeT& operator= (const CppRopeT&) noexcept = default;   //!< Default copy assignment
+        inline CppRopeT& operator= (CppRopeT&&) noexcept = default;        //!< Default move assignment
+
+
+        //---   Concatenation   ---------------------------------
+        /** \brief Returns the concatenation of two ropes. O(log n). */
+        [[nodiscard]]
+        inline friend CppRopeT operator+ (const CppRopeT& lhs, const CppRopeT& rhs)
+        {
+            return CppRopeT(_join(lhs.m_root, rhs.m_root));
+        }
+
+        /** \brief Appends a rope to this rope. O(log n). */
+        inline CppRopeT& operator+= (const CppRopeT& other)
+        {
+            m_root = _join(m_root, other.m_root);
+            return *this;
+        }
+
+        /** \brief Appends a character to this rope. */
+        inline CppRopeT& operator+= (const CharT ch)
+        {
+            m_root = _join(m_root, _leaf(string_type(ch)));
+            return *this;
+        }
+
+        /** \brief Returns a rope with count times the content of this rope. O(log(count) * log(n)). */
+        [[nodiscard]]
+        CppRopeT operator* (std::int64_t count) const
+        {
+            CppRopeT res{};
+            CppRopeT pow{ *this };
+            while (count > 0) {
+                if (count & 1)
+                    res += pow;
+                count >>= 1;
+                if (count > 0)
+                    pow += pow;
+            }
+            return res;
+        }
+
+
+        //---   Indexing   ----------------------------------
+        /** \brief Returns the character at position index. O(log n). No bounds checking. */
+        [[nodiscard]]
+        CharT operator[] (size_type index) const noexcept
+        {
+            const Node* node{ m_root.get() };
+            while (node->left) {
+                const size_type left_size{ node->left->size };
+                if (index < left_size) {
+                    node = node->left.get();
+                }
+                else {
+                    index -= left_size;
+                    node = node->right.get();
+                }
+            }
+            return node->buffer->data()[node->offset + index];
+        }
+
+
+        //---   contains()   --------------------------------
+        /** \brief Returns true if this rope contains the passed string, or false otherwise. */
+        [[nodiscard]]
+        inline bool contains(const view_type sub) const
+        {
+            return find(sub) != npos;
+        }
+
+
+        //---   count()   -----------------------------------
+        /** \brief Returns the number of non-overlapping occurrences of substring sub in the rope. */
+        [[nodiscard]]
+        size_type count(const view_type sub) const
+        {
+            if (sub.empty()) [[unlikely]]
+                return size() + 1;
+
+            size_type n{ 0 };
+            size_type next_allowed{ 0 };
+            _for_each_match(sub, 0, [&](const size_type pos) {
+                if (pos >= next_allowed) {
+                    ++n;
+                    next_allowed = pos + sub.size();
+                }
+                return true;
+            });
+            return n;
+        }
+
+
+        //---   depth()   -----------------------------------
+        /** \brief Returns the height of the tree of chunks of this rope, 0 for a one-chunk rope. */
+        [[nodiscard]]
+        inline size_type depth() const noexcept
+        {
+            return m_root ? m_root->height : 0;
+        }
+
+
+        //---   empty()   -----------------------------------
+        /** \brief Returns true if this rope contains no character. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return !m_root;
+        }
+
+
+        //---   find()   ------------------------------------
+        /** \brief Returns the lowest index in the rope, not less than start, where substring sub is found, or npos if sub is not found. */
+        [[nodiscard]]
+        size_type find(const view_type sub, const size_type start = 0) const
+        {
+            if (start > size()) [[unlikely]]
+                return npos;
+            if (sub.empty()) [[unlikely]]
+                return start;
+
+            size_type found_pos{ npos };
+            _for_each_match(sub, start, [&](const size_type pos) {
+                if (pos < start)
+                    return true;
+                found_pos = pos;
+                return false;
+            });
+            return found_pos;
+        }
+
+
+        //---   for_each_chunk()   --------------------------
+        /** \brief Calls func on a view of each chunk of this rope, from left to right. */
+        template<class FuncT>
+        inline void for_each_chunk(FuncT&& func) const
+        {
+            _for_each_chunk(m_root.get(), func);
+        }
+
+
+        //---   size()   ------------------------------------
+        /** \brief Returns the count of characters in this rope. O(1). */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_root ? m_root->size : 0;
+        }
+
+
+        //---   split()   -----------------------------------
+        /** \brief Returns a vector of the words in the whole rope, using sep as the delimiter string. Same semantics as CppStringT::split(sep, maxsplit). */
+        [[nodiscard]]
+        std::vector<string_type> split(const view_type sep, size_type maxsplit = npos) const
+        {
+            std::vector<string_type> res{};
+            if (sep.empty()) [[unlikely]] {
+                res.push_back(str());
+                return res;
+            }
+
+            size_type prev{ 0 };
+            _for_each_match(sep, 0, [&](const size_type pos) {
+                if (pos < prev)
+                    return true;
+                if (maxsplit-- == 0)
+                    return false;
+                res.push_back(substr(prev, pos - prev).str());
+                prev = pos + sep.size();
+                return true;
+            });
+            res.push_back(substr(prev).str());
+            return res;
+        }
+
+
+        //---   str()   -------------------------------------
+        /** \brief Flattens this rope into a string, with one single allocation. */
+        [[nodiscard]]
+        string_type str() const
+        {
+            string_type res{};
+            res.reserve(size());
+            for_each_chunk([&res](const view_type chunk) { res.append(chunk.data(), chunk.size()); });
+            return res;
+        }
+
+
+        //---   substr()   ----------------------------------
+        /** \brief Returns the sub-rope starting at index start and ending after count characters. O(log n). */
+        [[nodiscard]]
+        CppRopeT substr(const size_type start, const size_type count = npos) const
+        {
+            if (start >= size()) [[unlikely]]
+                return CppRopeT();
+
+            const size_type end{ count >= size() - start ? size() : start + count };
+            NodePtr right{ _split(m_root, start).second };
+            return CppRopeT(_split(right, end - start).first);
+        }
+
+
+    private:
+        //---   nodes   -------------------------------------
+        struct Node;
+        using NodePtr = std::shared_ptr<const Node>;
+
+        using BufferPtr = std::shared_ptr<const string_type>;
+
+        /** \brief A node of the tree, either a leaf which views the characters [offset, offset + size) of a shared buffer, or a concatenation of two non empty sub-ropes. */
+        struct Node
+        {
+            NodePtr   left{};       // null for leaves
+            NodePtr   right{};      // null for leaves
+            BufferPtr buffer{};     // null for concatenation nodes
+            size_type offset{ 0 };
+            size_type size{ 0 };
+            size_type height{ 0 };
+
+            [[nodiscard]]
+            inline view_type chunk() const noexcept  //!< returns the view of the characters of a leaf
+            {
+                return view_type(buffer->data() + offset, size);
+            }
+        };
+
+        NodePtr m_root{};   // null for the empty rope
+
+        inline explicit CppRopeT(NodePtr root) noexcept
+            : m_root{ std::move(root) }
+        {}
+
+        [[nodiscard]]
+        static inline size_type _height(const NodePtr& node) noexcept
+        {
+            return node ? node->height : 0;
+        }
+
+        [[nodiscard]]
+        static inline bool _is_small_leaf(const NodePtr& node) noexcept
+        {
+            return node && !node->left && node->size <= LEAF_MAX_SIZE;
+        }
+
+        [[nodiscard]]
+        static NodePtr _leaf(string_type&& chunk)
+        {
+            if (chunk.empty()) [[unlikely]]
+                return NodePtr();
+            const size_type chunk_size{ chunk.size() };
+            return std::make_shared<const Node>(Node{ NodePtr(), NodePtr(), std::make_shared<const string_type>(std::move(chunk)), 0, chunk_size, 0 });
+        }
+
+        /** \brief Returns the leaf viewing the count characters at offset within the chunk of leaf, sharing its buffer. */
+        [[nodiscard]]
+        static NodePtr _leaf_view(const NodePtr& leaf, const size_type offset, const size_type count)
+        {
+            return std::make_shared<const Node>(Node{ NodePtr(), NodePtr(), leaf->buffer, leaf->offset + offset, count, 0 });
+        }
+
+        [[nodiscard]]
+        static NodePtr _merged_leaves(const NodePtr& left, const NodePtr& right)
+        {
+            string_type chunk{};
+            chunk.reserve(left->size + right->size);
+            const view_type left_chunk{ left->chunk() };
+            const view_type right_chunk{ right->chunk() };
+            chunk.append(left_chunk.data(), left_chunk.size()).append(right_chunk.data(), right_chunk.size());
+            return _leaf(std::move(chunk));
+        }
+
+        [[nodiscard]]
+        static NodePtr _node(const NodePtr& left, const NodePtr& right)
+        {
+            return std::make_shared<const Node>(
+                Node{ left, right, BufferPtr(), 0, left->size + right->size, std::max(left->height, right->height) + 1 }
+            );
+        }
+
+        /** \brief Concatenates two trees, keeping them balanced as AVL trees do. O(|height(left) - height(right)|). */
+        [[nodiscard]]
+        static NodePtr _join(const NodePtr& left, const NodePtr& right)
+        {
+            if (!left)
+                return right;
+            if (!right)
+                return left;
+
+            const size_type hl{ left->height };
+            const size_type hr{ right->height };
+
+            if (hl > hr + 1) {
+                const NodePtr t{ _join(left->right, right) };
+                if (t->height <= left->left->height + 1)
+                    return _node(left->left, t);
+                else if (_height(t->left) > _height(t->right))  // double rotation
+                    return _node(_node(left->left, t->left->left), _node(t->left->right, t->right));
+                else                                            // single rotation
+                    return _node(_node(left->left, t->left), t->right);
+            }
+
+            if (hr > hl + 1) {
+                const NodePtr t{ _join(left, right->left) };
+                if (t->height <= right->right->height + 1)
+                    return _node(t, right->right);
+                else if (_height(t->right) > _height(t->left))  // double rotation
+                    return _node(_node(t->left, t->right->left), _node(t->right->right, right->right));
+                else                                            // single rotation
+                    return _node(t->left, _node(t->right, right->right));
+            }
+
+            // small chunks get merged, to avoid trees of tiny leaves when appending characters or short strings
+            if (_is_small_leaf(left) && _is_small_leaf(right) && left->size + right->size <= LEAF_MAX_SIZE)
+                return _merged_leaves(left, right);
+            if (left->left && _is_small_leaf(right) && _is_small_leaf(left->right) && left->right->size + right->size <= LEAF_MAX_SIZE)
+                return _join(left->left, _merged_leaves(left->right, right));
+            if (right->left && _is_small_leaf(left) && _is_small_leaf(right->left) && left->size + right->left->size <= LEAF_MAX_SIZE)
+                return _join(_merged_leaves(left, right->left), right->right);
+
+            return _node(left, right);
+        }
+
+        /** \brief Splits a tree into its [0, index) and [index, size) parts. O(log n), the split leaf being viewed by two new leaves. */
+        [[nodiscard]]
+        static std::pair<NodePtr, NodePtr> _split(const NodePtr& node, const size_type index)
+        {
+            if (!node || index == 0)
+                return { NodePtr(), node };
+            if (index >= node->size)
+                return { node, NodePtr() };
+
+            if (!node->left)
+                return { _leaf_view(node, 0, index), _leaf_view(node, index, node->size - index) };
+
+            const size_type left_size{ node->left->size };
+            if (index < left_size) {
+                auto [a, b] = _split(node->left, index);
+                return { a, _join(b, node->right) };
+            }
+            else if (index == left_size) {
+                return { node->left, node->right };
+            }
+            else {
+                auto [a, b] = _split(node->right, index - left_size);
+                return { _join(node->left, a), b };
+            }
+        }
+
+        template<class FuncT>
+        static void _for_each_chunk(const Node* node, FuncT& func)
+        {
+            if (node == nullptr)
+                return;
+            if (!node->left) {
+                func(node->chunk());
+            }
+            else {
+                _for_each_chunk(node->left.get(), func);
+                _for_each_chunk(node->right.get(), func);
+            }
+        }
+
+        /** \brief Calls func with the position of each occurrence, overlapping or not, of sub in increasing order, as long as func returns true.
+        *
+        * Chunks that end before position start are skipped. Matches that straddle
+        * consecutive chunks are searched for in a small window that contains the
+        * last sub.size()-1 characters already scanned and the first ones of  the
+        * current chunk.
+        */
+        template<class FuncT>
+        void _for_each_match(const view_type sub, const size_type start, FuncT&& func) const
+        {
+            const size_type m{ sub.size() };
+            string_type carry{};        // the last m-1 characters already scanned
+            string_type window{};
+            size_type offset{ 0 };      // position of the current chunk in the rope
+            bool go_on{ true };
+
+            for_each_chunk([&](const view_type chunk) {
+                if (!go_on)
+                    return;
+                if (offset + chunk.size() <= start) {  // no match may start in this chunk at or after start
+                    offset += chunk.size();
+                    carry.clear();
+                    return;
+                }
+
+                // matches that straddle the carried characters and this chunk
+                if (!carry.empty()) {
+                    window.assign(carry).append(chunk.data(), std::min(chunk.size(), m - 1));
+                    const view_type w(window);
+                    for (size_type p = w.find(sub); p != npos && p < carry.size(); p = w.find(sub, p + 1))
+                        if (!(go_on = func(offset - carry.size() + p)))
+                            return;
+                }
+
+                // matches fully contained in this chunk
+                for (size_type p = chunk.find(sub); p != npos; p = chunk.find(sub, p + 1))
+                    if (!(go_on = func(offset + p)))
+                        return;
+
+                // updates the carried characters
+                if (m > 1) {
+                    if (chunk.size() >= m - 1)
+                        carry.assign(chunk.data() + chunk.size() - (m - 1), m - 1);
+                    else {
+                        carry.append(chunk.data(), chunk.size());
+                        if (carry.size() > m - 1)
+                            carry.erase(0, carry.size() - (m - 1));
+                    }
+                }
+                offset += chunk.size();
+            });
+        }
+    };
+
+
+    //=====   Strings builders   ==================================
+    /** \brief The class of strings builders.
+    *
+    * A builder accumulates pieces of strings and runs of filling characters,
+    * keeping track of the exact size of the final string. Method str() then
+    * builds it with one single allocation and one single copy of each piece.
+    *
+    * CAUTION: for efficiency purposes, the builder does not copy the strings
+    * that are appended to it as lvalues, as views or as pointers: it  just
+    * references  them.  These strings must then remain alive and unchanged
+    * until the final string is built. Appended rvalue strings, characters
+    * and formatted texts are copied into chunked buffers owned by the builder.
+    * These buffers never get reallocated, they get chained instead.
+    *
+    * Builders are the counterpart of concatenation expressions (\see class
+    * CppConcatExprT) for results whose count of pieces is known at run time
+    * only, while expressions fit results of a fixed shape. CppStringT methods
+    * follow this rule: join() of containers and replace() use a builder,
+    * center(), ljust(), rjust(), zfill() and join() of lists of parameters
+    * use expressions. Expressions may be appended to builders.
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    class CppStringBuilderT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
+        using value_type  = CharT;
+        using size_type   = typename string_type::size_type;
+        using view_type   = std::basic_string_view<CharT, TraitsT>;
+
+        static constexpr size_type INLINE_PIECES_COUNT{ 8 };        //!< the count of pieces that are stored without any allocation
+        static constexpr size_type CHUNK_SIZE{ 4096 };              //!< the default count of characters of the owned chunks of characters
+
+
+        //---   Constructors / Destructor   -------------------
+        inline CppStringBuilderT() noexcept = default;                                      //!< Default constructor.
+        CppStringBuilderT(const CppStringBuilderT&) = delete;                               //!< Builders are not copyable, since pieces may point into their owned chunks.
+        inline CppStringBuilderT(CppStringBuilderT&&) noexcept = default;                   //!< Default move constructor.
+
+        inline ~CppStringBuilderT() noexcept = default;                                     //!< Default destructor.
+
+        CppStringBuilderT& operator= (const CppStringBuilderT&) = delete;                   //!< Builders are not copyable.
+        inline CppStringBuilderT& operator= (CppStringBuilderT&&) noexcept = default;       //!< Default move assignment.
+
+
+        //---   append()   ----------------------------------
+        /** \brief Appends a reference to a string view. The viewed characters must outlive the building of the string. */
+        inline CppStringBuilderT& append(const view_type str)
+        {
+            if (!str.empty()) [[likely]]
+                _push(Piece{ str.data(), str.size(), CharT() });
+            return *this;
+        }
+
+        /** \brief Appends a reference to a string. The string must outlive the building of the final string. */
+        inline CppStringBuilderT& append(const std::basic_string<CharT, TraitsT, AllocatorT>& str)
+        {
+            return append(view_type(str.data(), str.size()));
+        }
+
+        /** \brief Appends a copy of a temporary string. */
+        inline CppStringBuilderT& append(std::basic_string<CharT, TraitsT, AllocatorT>&& str)
+        {
+            if (!str.empty()) [[likely]] {
+                CharT* chars{ _owned(str.size()) };
+                TraitsT::copy(chars, str.data(), str.size());
+                _push(Piece{ chars, str.size(), CharT() });
+            }
+            return *this;
+        }
+
+        /** \brief Appends a reference to a null-terminated string. The string must outlive the building of the final string. */
+        inline CppStringBuilderT& append(const CharT* str)
+        {
+            return str == nullptr ? *this : append(view_type(str));
+        }
+
+        /** \brief Appends a character. */
+        inline CppStringBuilderT& append(const CharT ch)
+        {
+            return append_fill(1, ch);
+        }
+
+        /** \brief Appends a lazy concatenation expression, or one of its terms (\see concept ConcatTerm), evaluated into the chunks owned by the builder. */
+        template<class TermT>
+            requires requires(const TermT& term, CharT* dest) { { term.size() } -> std::convertible_to<size_type>; { term.copy_to(dest) } -> std::same_as<CharT*>; }
+        CppStringBuilderT& append(const TermT& term)
+        {
+            const size_type count{ term.size() };
+            if (count > 0) [[likely]] {
+                CharT* chars{ _owned(count) };
+                term.copy_to(chars);
+                _push(Piece{ chars, count, CharT() });
+            }
+            return *this;
+        }
+
+
+        //---   append_fill()   -----------------------------
+        /** \brief Appends a run of count characters ch. Nothing gets stored but the run itself. */
+        inline CppStringBuilderT& append_fill(const size_type count, const CharT ch)
+        {
+            if (count > 0) [[likely]]
+                _push(Piece{ nullptr, count, ch });
+            return *this;
+        }
+
+
+        //---   append_format()   ---------------------------
+        /** \brief Appends the formatted text according to c++20 std::format() specification.
+        *
+        * The text is formatted directly into the chunked buffers that  are
+        * owned by the builder. Available with char and wchar_t characters.
+        */
+        template<class... ArgsT>
+        CppStringBuilderT& append_format(const std::basic_format_string<CharT, std::type_identity_t<ArgsT>...> frmt, ArgsT&&... args)
+        {
+            const auto format_args{ _make_format_args(args...) };
+
+            // first try: formats into the free room of the current chunk
+            CharT* chars{ _free_room() };
+            size_type count{ 0 };
+            {
+                BoundedOutputT<CharT> output(std::span<CharT>(chars, _room()));
+                std::vformat_to(output.begin(), frmt.get(), format_args);
+                count = output.count();
+            }
+            if (count <= _room()) [[likely]] {
+                m_current_used += count;
+            }
+            else [[unlikely]] {
+                // not enough room: formats again into a big enough chunk
+                chars = _owned(count);
+                BoundedOutputT<CharT> output(std::span<CharT>(chars, count));
+                std::vformat_to(output.begin(), frmt.get(), format_args);
+            }
+            if (count > 0) [[likely]]
+                _push(Piece{ chars, count, CharT() });
+            return *this;
+        }
+
+
+        //---   append_join()   -----------------------------
+        /** \brief Appends the strings of a range separated with sep, as CppStringT::join() does. Strings and sep get referenced. */
+        template<class RangeT>
+        CppStringBuilderT& append_join(const view_type sep, const RangeT& strs)
+        {
+            bool first{ true };
+            for (const auto& str : strs) {
+                if (!first) [[likely]]
+                    append(sep);
+                first = false;
+                append(view_type(str));
+            }
+            return *this;
+        }
+
+
+        //---   build_into()   ------------------------------
+        /** \brief Appends the built string to the passed string, with at most one reallocation of it. Returns a reference to the passed string. */
+        std::basic_string<CharT, TraitsT, AllocatorT>& build_into(std::basic_string<CharT, TraitsT, AllocatorT>& out) const
+        {
+            out.reserve(out.size() + m_size);
+            for_each_piece([&out](const Piece& piece) {
+                if (piece.data == nullptr)
+                    out.append(piece.size, piece.fillch);
+                else
+                    out.append(piece.data, piece.size);
+            });
+            return out;
+        }
+
+
+        //---   clear()   -----------------------------------
+        /** \brief Removes all pieces from this builder. The owned chunks are kept for reuse. */
+        inline void clear() noexcept
+        {
+            m_inline_count = 0;
+            m_more_pieces.clear();
+            m_size = 0;
+            m_current_chunk = 0;
+            m_current_used = 0;
+        }
+
+
+        //---   empty()   -----------------------------------
+        /** \brief Returns true if the built string would be empty. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return m_size == 0;
+        }
+
+
+        //---   size()   ------------------------------------
+        /** \brief Returns the exact count of characters of the string to be built. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_size;
+        }
+
+
+        //---   str()   -------------------------------------
+        /** \brief Builds the final string, with one single allocation. */
+        [[nodiscard]]
+        inline string_type str() const
+        {
+            string_type res{};
+            build_into(res);
+            return res;
+        }
+
+
+    private:
+        //---   pieces   ------------------------------------
+        /** \brief A piece of string, either a reference to characters or a run of the same filling character when data is null. */
+        struct Piece
+        {
+            const CharT* data;
+            size_type    size;
+            CharT        fillch;
+        };
+
+        /** \brief An owned chunk of characters. */
+        struct Chunk
+        {
+            std::unique_ptr<CharT[]> data;
+            size_type                capacity;
+        };
+
+        std::array<Piece, INLINE_PIECES_COUNT> m_inline_pieces{};
+        size_type m_inline_count{ 0 };
+        std::vector<Piece> m_more_pieces{};
+        size_type m_size{ 0 };
+
+        std::vector<Chunk> m_chunks{};
+        size_type m_current_chunk{ 0 };
+        size_type m_current_used{ 0 };
+
+        inline void _push(const Piece& piece)
+        {
+            if (m_inline_count < INLINE_PIECES_COUNT) [[likely]]
+                m_inline_pieces[m_inline_count++] = piece;
+            else [[unlikely]]
+                m_more_pieces.push_back(piece);
+            m_size += piece.size;
+        }
+
+        template<class FuncT>
+        inline void for_each_piece(FuncT&& func) const
+        {
+            for (size_type i = 0; i < m_inline_count; ++i)
+                func(m_inline_pieces[i]);
+            for (const Piece& piece : m_more_pieces)
+                func(piece);
+        }
+
+        /** \brief Returns the count of free characters in the current chunk. */
+        [[nodiscard]]
+        inline size_type _room() const noexcept
+        {
+            return m_current_chunk < m_chunks.size() ? m_chunks[m_current_chunk].capacity - m_current_used : 0;
+        }
+
+        /** \brief Returns a pointer to the free room of the current chunk, or nullptr if there is no chunk yet. */
+        [[nodiscard]]
+        inline CharT* _free_room() noexcept
+        {
+            return m_current_chunk < m_chunks.size() ? m_chunks[m_current_chunk].data.get() + m_current_used : nullptr;
+        }
+
+        /** \brief Returns a pointer to count owned characters, chaining a new chunk if needed. */
+        [[nodiscard]]
+        CharT* _owned(const size_type count)
+        {
+            if (count <= _room()) [[likely]] {
+                CharT* chars{ _free_room() };
+                m_current_used += count;
+                return chars;
+            }
+
+            // next chunk with enough room, or a new one
+            size_type next{ m_chunks.empty() ? 0 : m_current_chunk + 1 };
+            while (next < m_chunks.size() && m_chunks[next].capacity < count)
+                ++next;
+            if (next == m_chunks.size()) {
+                const size_type capacity{ std::max(count, CHUNK_SIZE) };
+                m_chunks.push_back(Chunk{ std::make_unique<CharT[]>(capacity), capacity });
+            }
+            m_current_chunk = next;
+            m_current_used = count;
+            return m_chunks[next].data.get();
+        }
+
+        template<class... ArgsT>
+        [[nodiscard]]
+        static inline auto _make_format_args(ArgsT&... args)
+        {
+            if constexpr (std::is_same_v<CharT, wchar_t>)
+                return std::make_wformat_args(args...);
+            else
+                return std::make_format_args(args...);
+        }
+    };
+
+
+    //=====   Concatenation expressions   =========================
+    /** \brief The concept of the terms of lazy concatenations expressions.
+    *
+    * A term knows its count of characters and copies them into a buffer.
+    * Terms are: references to strings (views), owned temporary strings,
+    * single characters, runs of filling characters and concatenation
+    * expressions themselves.
+    */
+    template<class TermT>
+    concept ConcatTerm = requires(const TermT& term, typename TermT::char_type* dest)
+    {
+        typename TermT::char_type;
+        typename TermT::traits_type;
+        { term.size() } -> std::convertible_to<std::size_t>;
+        { term.copy_to(dest) } -> std::same_as<typename TermT::char_type*>;
+    };
+
+
+    //---   terms   -----------------------------------------------
+    /** \brief A term that references some characters, i.e. a string view. */
+    template<class CharT, class TraitsT>
+    struct ConcatViewT
+    {
+        using char_type   = CharT;
+        using traits_type = TraitsT;
+
+        std::basic_string_view<CharT, TraitsT> view;
+
+        [[nodiscard]]
+        inline constexpr std::size_t size() const noexcept { return view.size(); }
+
+        inline CharT* copy_to(CharT* dest) const noexcept
+        {
+            TraitsT::copy(dest, view.data(), view.size());
+            return dest + view.size();
+        }
+    };
+
+    /** \brief A term that owns a temporary string, moved into it, so that it lives as long as the expression. */
+    template<class CharT, class TraitsT, class AllocatorT>
+    struct ConcatOwnedT
+    {
+        using char_type   = CharT;
+        using traits_type = TraitsT;
+
+        std::basic_string<CharT, TraitsT, AllocatorT> str;
+
+        [[nodiscard]]
+        inline std::size_t size() const noexcept { return str.size(); }
+
+        inline CharT* copy_to(CharT* dest) const noexcept
+        {
+            TraitsT::copy(dest, str.data(), str.size());
+            return dest + str.size();
+        }
+    };
+
+    /** \brief A term that is one single character. */
+    template<class CharT, class TraitsT>
+    struct ConcatCharT
+    {
+        using char_type   = CharT;
+        using traits_type = TraitsT;
+
+        CharT ch;
+
+        [[nodiscard]]
+        inline constexpr std::size_t size() const noexcept { return 1; }
+
+        inline CharT* copy_to(CharT* dest) const noexcept
+        {
+            *dest = ch;
+            return dest + 1;
+        }
+    };
+
+    /** \brief A term that is a run of count times the same filling character. \see pcs::fill(). */
+    template<class CharT, class TraitsT>
+    struct FillRunT
+    {
+        using char_type   = CharT;
+        using traits_type = TraitsT;
+
+        std::size_t count;
+        CharT       ch;
+
+        [[nodiscard]]
+        inline constexpr std::size_t size() const noexcept { return count; }
+
+        inline CharT* copy_to(CharT* dest) const noexcept
+        {
+            TraitsT::assign(dest, count, ch);
+            return dest + count;
+        }
+    };
+
+
+    //---   concatenation expressions   ---------------------------
+    /** \brief The class of lazy concatenations expressions.
+    *
+    * Concatenating terms with operator+ just builds a tree of terms, checked
+    * at compile time.  Nothing gets allocated nor copied until the expression
+    * is converted into a string: the total length is then computed once, the
+    * resulting string gets allocated once and each term is copied once.
+    *
+    * Lazy concatenations start as soon as one of the operands of operator+ is
+    * a term: use functions pcs::concat() and pcs::fill() to create the first
+    * ones. Strings that are concatenated as lvalues are referenced, rvalues
+    * are moved into the expression.
+    *
+    * Expressions fit results of a fixed shape, builders (\see class
+    * CppStringBuilderT) the ones with a count of pieces known at run time.
+    *
+    * Example:
+    *   pcs::CppString s = pcs::fill(4, '.') + title + ": " + value + '\n';
+    */
+    template<ConcatTerm LeftT, ConcatTerm RightT>
+        requires std::is_same_v<typename LeftT::char_type, typename RightT::char_type>
+    class CppConcatExprT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using char_type   = typename LeftT::char_type;
+        using traits_type = typename LeftT::traits_type;
+
+        //---   Constructors / Destructor   -------------------
+        inline CppConcatExprT(LeftT left, RightT right) noexcept(std::is_nothrow_move_constructible_v<LeftT> && std::is_nothrow_move_constructible_v<RightT>)
+            : m_left{ std::move(left) }
+            , m_right{ std::move(right) }
+        {}
+
+        //---   properties   ----------------------------------
+        /** \brief Returns the count of characters of the concatenation. */
+        [[nodiscard]]
+        inline std::size_t size() const noexcept
+        {
+            return m_left.size() + m_right.size();
+        }
+
+        /** \brief Copies the characters of the concatenation into dest, which must be big enough. Returns a pointer right after the last copied character. */
+        inline char_type* copy_to(char_type* dest) const noexcept
+        {
+            return m_right.copy_to(m_left.copy_to(dest));
+        }
+
+        //---   evaluation   ----------------------------------
+        /** \brief Appends the concatenation to the passed string, with at most one reallocation of it. */
+        template<class AllocatorT>
+        std::basic_string<char_type, traits_type, AllocatorT>& append_to(std::basic_string<char_type, traits_type, AllocatorT>& out) const
+        {
+            const std::size_t prev_size{ out.size() };
+            const std::size_t new_size{ prev_size + size() };
+#if defined(__cpp_lib_string_resize_and_overwrite)
+            out.resize_and_overwrite(new_size, [this, prev_size, new_size](char_type* chars, std::size_t) noexcept {
+                copy_to(chars + prev_size);
+                return new_size;
+            });
+#else
+            out.resize(new_size);
+            copy_to(out.data() + prev_size);
+#endif
+            return out;
+        }
+
+        /** \brief Evaluates the concatenation into a new string, with one single allocation. */
+        template<class AllocatorT = std::allocator<char_type>>
+        [[nodiscard]]
+        inline CppStringT<char_type, traits_type, AllocatorT> str() const
+        {
+            CppStringT<char_type, traits_type, AllocatorT> res{};
+            append_to(res);
+            return res;
+        }
+
+        /** \brief Implicit conversion to strings, evaluates the concatenation with one single allocation. */
+        template<class AllocatorT>
+        [[nodiscard]]
+        inline operator CppStringT<char_type, traits_type, AllocatorT>() const
+        {
+            return str<AllocatorT>();
+        }
+
+    private:
+        LeftT  m_left;
+        RightT m_right;
+    };
+
+
+    //---   concat_term()   ---------------------------------------
+    /** \brief Returns the term passed as argument. */
+    template<class TermT>
+        requires ConcatTerm<std::remove_cvref_t<TermT>>
+    [[nodiscard]]
+    inline std::remove_cvref_t<TermT> concat_term(TermT&& term)
+    {
+        return std::forward<TermT>(term);
+    }
+
+    /** \brief Returns a view term on a string that is not a temporary one. */
+    template<class CharT, class TraitsT, class AllocatorT>
+    [[nodiscard]]
+    inline ConcatViewT<CharT, TraitsT> concat_term(const std::basic_string<CharT, TraitsT, AllocatorT>& str) noexcept
+    {
+        return ConcatViewT<CharT, TraitsT>{ std::basic_string_view<CharT, TraitsT>(str.data(), str.size()) };
+    }
+
+    /** \brief Returns an owned term that gets the content of a temporary string. */
+    template<class CharT, class TraitsT, class AllocatorT>
+    [[nodiscard]]
+    inline ConcatOwnedT<CharT, TraitsT, AllocatorT> concat_term(std::basic_string<CharT, TraitsT, AllocatorT>&& str) noexcept
+    {
+        return ConcatOwnedT<CharT, TraitsT, AllocatorT>{ std::move(str) };
+    }
+
+    /** \brief Returns a view term on a string view. */
+    template<class CharT, class TraitsT>
+    [[nodiscard]]
+    inline ConcatViewT<CharT, TraitsT> concat_term(const std::basic_string_view<CharT, TraitsT> view) noexcept
+    {
+        return ConcatViewT<CharT, TraitsT>{ view };
+    }
+
+    /** \brief Returns a view term on a null-terminated string. */
+    template<class CharT>
+    [[nodiscard]]
+    inline ConcatViewT<CharT> concat_term(const CharT* str) noexcept
+    {
+        return ConcatViewT<CharT>{ str == nullptr ? std::basic_string_view<CharT>() : std::basic_string_view<CharT>(str) };
+    }
+
+    /** \brief Returns a one-character term. */
+    template<class CharT>
+        requires std::is_same_v<CharT, char> || std::is_same_v<CharT, wchar_t> || std::is_same_v<CharT, char8_t> || std::is_same_v<CharT, char16_t> || std::is_same_v<CharT, char32_t>
+    [[nodiscard]]
+    inline ConcatCharT<CharT> concat_term(const CharT ch) noexcept
+    {
+        return ConcatCharT<CharT>{ ch };
+    }
+
+    /** \brief The concept of the operands that may be concatenated in lazy concatenations expressions. */
+    template<class T>
+    concept ConcatOperand = requires(T&& operand) { { pcs::concat_term(std::forward<T>(operand)) } -> ConcatTerm; };
+
+
+    //---   operator+   -------------------------------------------
+    /** \brief Lazy concatenation of a term with any operand. */
+    template<class LeftT, ConcatOperand RightT>
+        requires ConcatTerm<std::remove_cvref_t<LeftT>>
+    [[nodiscard]]
+    inline auto operator+ (LeftT&& left, RightT&& right)
+    {
+        using L = std::remove_cvref_t<LeftT>;
+        using R = decltype(pcs::concat_term(std::forward<RightT>(right)));
+        return CppConcatExprT<L, R>(std::forward<LeftT>(left), pcs::concat_term(std::forward<RightT>(right)));
+    }
+
+    /** \brief Lazy concatenation of any operand that is not a term with a term. */
+    template<ConcatOperand LeftT, class RightT>
+        requires (!ConcatTerm<std::remove_cvref_t<LeftT>> && ConcatTerm<std::remove_cvref_t<RightT>>)
+    [[nodiscard]]
+    inline auto operator+ (LeftT&& left, RightT&& right)
+    {
+        using L = decltype(pcs::concat_term(std::forward<LeftT>(left)));
+        using R = std::remove_cvref_t<RightT>;
+        return CppConcatExprT<L, R>(pcs::concat_term(std::forward<LeftT>(left)), std::forward<RightT>(right));
+    }
+
+
+    //---   concat()   --------------------------------------------
+    /** \brief Starts a lazy concatenation expression with the passed operands. \see class CppConcatExprT. */
+    template<ConcatOperand FirstT, ConcatOperand... OthersT>
+    [[nodiscard]]
+    inline auto concat(FirstT&& first, OthersT&&... others)
+    {
+        using FirstTermT = decltype(pcs::concat_term(std::forward<FirstT>(first)));
+        if constexpr (sizeof...(others) == 0)
+            // an empty view gets appended so that the result is an expression in any case
+            return pcs::concat_term(std::forward<FirstT>(first)) + ConcatViewT<typename FirstTermT::char_type, typename FirstTermT::traits_type>{};
+        else
+            return (pcs::concat_term(std::forward<FirstT>(first)) + ... + std::forward<OthersT>(others));
+    }
+
+
+    //---   fill()   ----------------------------------------------
+    /** \brief Returns a run of count times the filling character ch, to be used in lazy concatenation expressions. */
+    template<class CharT>
+    [[nodiscard]]
+    inline constexpr FillRunT<CharT> fill(const std::size_t count, const CharT ch) noexcept
+    {
+        return FillRunT<CharT>{ count, ch };
+    }
+
+
+    //=====   Multiple replacements   =============================
+    /** \brief The class of compiled sets of substitutions.
+    *
+    * A replacer is built once from a set of pairs {old, new_}. The old
+    * substrings are compiled into a trie  that gets walked from each
+    * position of the scanned strings that starts with one of the first
+    * characters of the old substrings. The longest old substring that
+    * matches at the leftmost position gets replaced, then the scan goes
+    * on after it. Empty old substrings are ignored. When an old substring
+    * is set more than once, its last new substring is the one used.
+    *
+    * Replacing scans the string once,  then allocates the resulting string
+    * at its exact size. Replacers are immutable once built, so they can be
+    * used concurrently by many threads.
+    */
+    template<class CharT, class TraitsT>
+    class ReplacerT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using size_type = std::size_t;
+        using view_type = std::basic_string_view<CharT, TraitsT>;
+        using pair_type = std::pair<view_type, view_type>;
+
+
+        //---   Constructors / Destructor   -------------------
+        /** \brief Builds a replacer from a braced list of pairs {old, new_}. */
+        inline ReplacerT(std::initializer_list<pair_type> substitutions)
+        {
+            for (const auto& [old, new_] : substitutions)
+                _add(old, new_);
+            _compile();
+        }
+
+        /** \brief Builds a replacer from a range of pairs {old, new_}. */
+        template<std::ranges::input_range RangeT>
+        explicit ReplacerT(const RangeT& substitutions)
+        {
+            for (const auto& [old, new_] : substitutions)
+                _add(view_type(old), view_type(new_));
+            _compile();
+        }
+
+
+        //---   replace()   ---------------------------------
+        /** \brief Returns a copy of text with all the substitutions done in one single pass. */
+        template<class AllocatorT = std::allocator<CharT>>
+        [[nodiscard]]
+        CppStringT<CharT, TraitsT, AllocatorT> replace(const view_type text) const
+        {
+            // scans the text once, noting the matches and evaluating the size of the result
+            std::vector<Match> matches{};
+            size_type res_size{ text.size() };
+            const CharT* const chars{ text.data() };
+            const size_type text_size{ text.size() };
+            size_type index{ 0 };
+            while (index < text_size) {
+                if (!m_first_chars[_low_byte(chars[index])]) [[likely]] {
+                    ++index;
+                    continue;
+                }
+
+                std::uint32_t node{ 0 };
+                std::uint32_t pattern{ NO_PATTERN };
+                size_type length{ 0 };
+                for (size_type i = index; i < text_size && (node = _child(node, chars[i])) != NO_NODE; ++i) {
+                    if (m_nodes[node].pattern != NO_PATTERN) {
+                        pattern = m_nodes[node].pattern;
+                        length = i - index + 1;
+                    }
+                }
+
+                if (pattern == NO_PATTERN) [[likely]] {
+                    ++index;
+                }
+                else [[unlikely]] {
+                    matches.push_back(Match{ index, length, pattern });
+                    res_size = res_size - length + m_news[pattern].size();
+                    index += length;
+                }
+            }
+
+            // then builds the result with one single allocation
+            CppStringT<CharT, TraitsT, AllocatorT> res{};
+            const auto fill = [&](CharT* out) noexcept {
+                size_type prev_index{ 0 };
+                for (const Match& match : matches) {
+                    out = std::copy(chars + prev_index, chars + match.index, out);
+                    const auto& new_{ m_news[match.pattern] };
+                    out = std::copy(new_.cbegin(), new_.cend(), out);
+                    prev_index = match.index + match.length;
+                }
+                std::copy(chars + prev_index, chars + text_size, out);
+            };
+#if defined(__cpp_lib_string_resize_and_overwrite)
+            res.resize_and_overwrite(res_size, [&fill, res_size](CharT* out, std::size_t) noexcept {
+                fill(out);
+                return res_size;
+            });
+#else
+            res.resize(res_size);
+            fill(res.data());
+#endif
+            return res;
+        }
+
+        /** \brief Same as replace(). */
+        template<class AllocatorT = std::allocator<CharT>>
+        [[nodiscard]]
+        inline CppStringT<CharT, TraitsT, AllocatorT> operator() (const view_type text) const
+        {
+            return replace<AllocatorT>(text);
+        }
+
+
+        //---   properties   ----------------------------------
+        /** \brief Returns the count of substitutions of this replacer. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_news.size();
+        }
+
+
+    private:
+        static constexpr std::uint32_t NO_NODE{ 0 };       // the root node is never a child
+        static constexpr std::uint32_t NO_PATTERN{ std::uint32_t(-1) };
+        static constexpr size_type LINEAR_SEARCH_MAX{ 16 };  // max count of edges searched linearly
+
+        /** \brief A node of the trie, with its edges stored contiguously and sorted by characters. */
+        struct Node
+        {
+            std::uint32_t first_edge{ 0 };
+            std::uint32_t edges_count{ 0 };
+            std::uint32_t pattern{ NO_PATTERN };    // index of the new substring when an old one ends at this node
+        };
+
+        /** \brief A match of an old substring in the scanned text. */
+        struct Match
+        {
+            size_type     index;
+            size_type     length;
+            std::uint32_t pattern;
+        };
+
+        std::vector<Node> m_nodes{ Node{} };
+        std::vector<CharT> m_edges_chars{};
+        std::vector<std::uint32_t> m_edges_nodes{};
+        std::vector<std::basic_string<CharT, TraitsT>> m_news{};
+        std::array<bool, 256> m_first_chars{};      // filter on the low byte of the first characters of old substrings
+
+        std::vector<std::map<CharT, std::uint32_t>> m_building_edges = std::vector<std::map<CharT, std::uint32_t>>(1);  // the edges of the trie while it is being built
+
+        /** \brief Returns the low byte of a character. */
+        [[nodiscard]]
+        static inline std::size_t _low_byte(const CharT ch) noexcept
+        {
+            return std::size_t(static_cast<std::make_unsigned_t<CharT>>(ch) & 0xff);
+        }
+
+        /** \brief Adds a substitution to the trie being built. */
+        void _add(const view_type old, const view_type new_)
+        {
+            if (old.empty()) [[unlikely]]
+                return;
+
+            std::uint32_t node{ 0 };
+            for (const CharT ch : old) {
+                auto it{ m_building_edges[node].find(ch) };
+                if (it == m_building_edges[node].end()) {
+                    const std::uint32_t child{ std::uint32_t(m_nodes.size()) };
+                    m_nodes.push_back(Node{});
+                    m_building_edges.emplace_back();
+                    it = m_building_edges[node].emplace(ch, child).first;
+                }
+                node = it->second;
+            }
+
+            if (m_nodes[node].pattern == NO_PATTERN) [[likely]] {
+                m_nodes[node].pattern = std::uint32_t(m_news.size());
+                m_news.emplace_back(new_);
+            }
+            else [[unlikely]] {
+                m_news[m_nodes[node].pattern] = new_;
+            }
+            m_first_chars[_low_byte(old.front())] = true;
+        }
+
+        /** \brief Stores the edges of the built trie contiguously. */
+        void _compile()
+        {
+            for (std::size_t node = 0; node < m_nodes.size(); ++node) {
+                m_nodes[node].first_edge = std::uint32_t(m_edges_chars.size());
+                m_nodes[node].edges_count = std::uint32_t(m_building_edges[node].size());
+                for (const auto& [ch, child] : m_building_edges[node]) {
+                    m_edges_chars.push_back(ch);
+                    m_edges_nodes.push_back(child);
+                }
+            }
+            m_building_edges.clear();
+            m_building_edges.shrink_to_fit();
+        }
+
+        /** \brief Returns the child of node via character ch, or NO_NODE if there is none. */
+        [[nodiscard]]
+        inline std::uint32_t _child(const std::uint32_t node, const CharT ch) const noexcept
+        {
+            const CharT* const first{ m_edges_chars.data() + m_nodes[node].first_edge };
+            const CharT* const last{ first + m_nodes[node].edges_count };
+            const CharT* const found{ (m_nodes[node].edges_count <= LINEAR_SEARCH_MAX) ? std::find(first, last, ch) : std::lower_bound(first, last, ch) };
+            return (found != last && *found == ch) ? m_edges_nodes[found - m_edges_chars.data()] : NO_NODE;
+        }
+    };
+
+
+    //=====   Strings columns   ===================================
+    /** \brief The class of columns of strings, i.e. of strings stored contiguously.
+    *
+    * All the characters of all the strings of a column are stored in one
+    * single buffer, and the strings are delimited by an array of offsets
+    * in this buffer:  string i is made of the characters at indexes from
+    * offsets[i] up to offsets[i+1] excluded.  Compared with  vectors  of
+    * strings, this saves the header and the heap block of each string and
+    * gets the characters processed with tight loops over contiguous memory,
+    * which compilers vectorize.
+    *
+    * Columns get converted to and from vectors of strings. Their strings
+    * are accessed as string views. Batch versions of the pythonic methods
+    * run over the whole column and return either a new column or a vector
+    * of booleans, one per string.
+    */
+    template<class CharT, class TraitsT>
+    class StringColumnT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using size_type   = std::size_t;
+        using view_type   = std::basic_string_view<CharT, TraitsT>;
+        using string_type = CppStringT<CharT, TraitsT>;
+
+
+        //---   Constructors / Destructor   -------------------
+        inline StringColumnT() noexcept = default;             //!< Default constructor, empty column
+
+        /** \brief Constructor with a list of strings. */
+        inline StringColumnT(std::initializer_list<view_type> strings)
+        {
+            for (const view_type str : strings)
+                push_back(str);
+        }
+
+        /** \brief Constructor with a vector of strings. */
+        template<class AllocatorT>
+        explicit StringColumnT(const std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings)
+        {
+            size_type chars_count{ 0 };
+            for (const auto& str : strings)
+                chars_count += str.size();
+            reserve(strings.size(), chars_count);
+            for (const auto& str : strings)
+                push_back(view_type(str));
+        }
+
+
+        //---   accessors   -----------------------------------
+        /** \brief Returns a view on the index-th string of this column. */
+        [[nodiscard]]
+        inline view_type operator[] (const size_type index) const noexcept
+        {
+            return view_type(m_chars.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+        }
+
+        /** \brief Returns the buffer of all the characters of this column. */
+        [[nodiscard]]
+        inline std::span<const CharT> chars() const noexcept
+        {
+            return std::span<const CharT>(m_chars);
+        }
+
+        /** \brief Returns the count of characters of all the strings of this column. */
+        [[nodiscard]]
+        inline size_type chars_count() const noexcept
+        {
+            return m_chars.size();
+        }
+
+        /** \brief Returns true if this column contains no string, or false otherwise. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return size() == 0;
+        }
+
+        /** \brief Returns the offsets of the strings in the buffer of characters, i.e. size() + 1 offsets. */
+        [[nodiscard]]
+        inline std::span<const size_type> offsets() const noexcept
+        {
+            return std::span<const size_type>(m_offsets);
+        }
+
+        /** \brief Returns the count of strings in this column. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_offsets.size() - 1;
+        }
+
+        /** \brief Returns a lazy range of views on the strings of this column. */
+        [[nodiscard]]
+        inline auto views() const noexcept
+        {
+            return std::views::iota(size_type(0), size()) | std::views::transform([this](const size_type index) { return (*this)[index]; });
+        }
+
+
+        //---   modifiers   -----------------------------------
+        /** \brief Assigns this column with count strings, the index-th one being the view returned by get_view(index). Returns a reference to this column.
+        *
+        * Offsets get computed first, so that the buffer of characters gets
+        * allocated once.  Characters are then copied on threads_count threads
+        * (0 stands for the count of hardware threads), get_view being called
+        * concurrently.
+        */
+        template<class GetViewT>
+        StringColumnT& assign(const size_type count, GetViewT&& get_view, const size_type threads_count = 0)
+        {
+            m_offsets.resize(count + 1);
+            for (size_type index = 0; index < count; ++index)
+                m_offsets[index + 1] = m_offsets[index] + view_type(get_view(index)).size();
+            m_chars.resize(m_offsets[count]);
+
+            parallel_for_chunks(count, parallel_chunks_count(count, threads_count, PARALLEL_MIN_ITEMS), [&](const size_type, const size_type first, const size_type last) {
+                for (size_type index = first; index < last; ++index) {
+                    const view_type str(get_view(index));
+                    TraitsT::copy(m_chars.data() + m_offsets[index], str.data(), str.size());
+                }
+            });
+            return *this;
+        }
+
+        /** \brief Removes all the strings of this column, keeping the capacity of its buffers. */
+        inline void clear() noexcept
+        {
+            m_chars.clear();
+            m_offsets.resize(1);
+        }
+
+        /** \brief Appends a string at the end of this column. */
+        inline void push_back(const view_type str)
+        {
+            m_chars.insert(m_chars.end(), str.begin(), str.end());
+            m_offsets.push_back(m_chars.size());
+        }
+
+        /** \brief Reserves memory for strings_count strings with chars_count characters overall. */
+        inline void reserve(const size_type strings_count, const size_type chars_count)
+        {
+            m_offsets.reserve(strings_count + 1);
+            m_chars.reserve(chars_count);
+        }
+
+
+        //---   conversions   ---------------------------------
+        /** \brief Returns a vector of strings with a copy of each string of this column. */
+        template<class AllocatorT = std::allocator<CharT>>
+        [[nodiscard]]
+        std::vector<CppStringT<CharT, TraitsT, AllocatorT>> to_vector() const
+        {
+            std::vector<CppStringT<CharT, TraitsT, AllocatorT>> res{};
+            res.reserve(size());
+            for (size_type index = 0; index < size(); ++index)
+                res.emplace_back(m_chars.data() + m_offsets[index], m_offsets[index + 1] - m_offsets[index]);
+            return res;
+        }
+
+
+        //---   batch predicates   --------------------------
+        /** \brief Returns, for each string of this column, true if it contains sub, or false otherwise.
+        *
+        * The whole buffer of characters is searched at once, each match
+        * being then located in its string via the offsets. The search goes
+        * on from the next string once a string has been found to contain sub.
+        */
+        [[nodiscard]]
+        std::vector<bool> contains(const view_type sub) const
+        {
+            std::vector<bool> res(size(), sub.empty());
+            if (sub.empty()) [[unlikely]]
+                return res;
+
+            const view_type all_chars(m_chars.data(), m_chars.size());
+            size_type pos{ 0 };
+            while ((pos = all_chars.find(sub, pos)) != view_type::npos) {
+                const size_type index{ size_type(std::ranges::upper_bound(m_offsets, pos) - m_offsets.cbegin()) - 1 };
+                if (pos + sub.size() <= m_offsets[index + 1]) [[likely]] {
+                    res[index] = true;
+                    pos = m_offsets[index + 1];
+                }
+                else [[unlikely]] {
+                    ++pos;      // this match straddles two strings
+                }
+            }
+            return res;
+        }
+
+        /** \brief Returns, for each string of this column, true if it ends with suffix, or false otherwise. */
+        [[nodiscard]]
+        std::vector<bool> endswith(const view_type suffix) const
+        {
+            std::vector<bool> res(size());
+            for (size_type index = 0; index < size(); ++index)
+                res[index] = (*this)[index].ends_with(suffix);
+            return res;
+        }
+
+        /** \brief Returns, for each string of this column, true if it starts with prefix, or false otherwise. */
+        [[nodiscard]]
+        std::vector<bool> startswith(const view_type prefix) const
+        {
+            std::vector<bool> res(size());
+            for (size_type index = 0; index < size(); ++index)
+                res[index] = (*this)[index].starts_with(prefix);
+            return res;
+        }
+
+
+        //---   batch transforms   --------------------------
+        /** \brief Returns a column with the lowercase conversion of each string, as CppStringT::lower() does. */
+        [[nodiscard]]
+        StringColumnT lower() const
+        {
+            return _map_chars([](const CharT ch) { return string_type::lower(ch); });
+        }
+
+        /** \brief Returns a column with a copy of each string where all the occurrences of substring old are replaced by new_, as CppStringT::replace() does. */
+        [[nodiscard]]
+        StringColumnT replace(const view_type old, const view_type new_) const
+        {
+            if (old.empty()) [[unlikely]]
+                return *this;
+
+            StringColumnT res{};
+            res.reserve(size(), m_chars.size());
+            for (size_type index = 0; index < size(); ++index) {
+                const view_type str{ (*this)[index] };
+                size_type prev_pos{ 0 };
+                size_type pos{ 0 };
+                while ((pos = str.find(old, prev_pos)) != view_type::npos) {
+                    res.m_chars.insert(res.m_chars.end(), str.begin() + prev_pos, str.begin() + pos);
+                    res.m_chars.insert(res.m_chars.end(), new_.begin(), new_.end());
+                    prev_pos = pos + old.size();
+                }
+                res.push_back(str.substr(prev_pos));
+            }
+            return res;
+        }
+
+        /** \brief Returns a column with the slice [start:stop] of each string, with Python semantics for negative and out of range indexes. */
+        [[nodiscard]]
+        StringColumnT slice(const std::int64_t start, const std::int64_t stop = std::numeric_limits<std::int64_t>::max()) const
+        {
+            return _map_views([start, stop](const view_type str) {
+                const std::int64_t len{ std::int64_t(str.size()) };
+                const auto clamp = [len](const std::int64_t index) { return std::clamp(index < 0 ? index + len : index, std::int64_t(0), len); };
+                const std::int64_t first{ clamp(start) };
+                const std::int64_t last{ clamp(stop) };
+                return (first < last) ? str.substr(size_type(first), size_type(last - first)) : view_type();
+            });
+        }
+
+        /** \brief Returns a column with all the words of all the strings, using sep as the delimiter string, as CppStringT::split_into() does.
+        *
+        * The words of string i are the ones at indexes from rows[i]  up  to
+        * rows[i+1] excluded in the returned column,  rows being cleared and
+        * then filled with size() + 1 indexes.
+        */
+        [[nodiscard]]
+        StringColumnT split(const view_type sep, std::vector<size_type>& rows) const
+        {
+            StringColumnT res{};
+            res.reserve(size(), m_chars.size());
+            rows.clear();
+            rows.reserve(size() + 1);
+            for (size_type index = 0; index < size(); ++index) {
+                rows.push_back(res.size());
+                const view_type str{ (*this)[index] };
+                size_type word_start{ 0 };
+                size_type pos{ 0 };
+                while (!sep.empty() && (pos = str.find(sep, word_start)) != view_type::npos) {
+                    res.push_back(str.substr(word_start, pos - word_start));
+                    word_start = pos + sep.size();
+                }
+                res.push_back(str.substr(word_start));
+            }
+            rows.push_back(res.size());
+            return res;
+        }
+
+        /** \brief Returns a column with a copy of each string with its leading and trailing whitespaces removed, as CppStringT::strip() does. */
+        [[nodiscard]]
+        inline StringColumnT strip() const
+        {
+            return strip(CharSetT<CharT>{ CharT(' ') });
+        }
+
+        /** \brief Returns a column with a copy of each string with its leading and trailing characters that are in set removedchars removed. */
+        [[nodiscard]]
+        StringColumnT strip(const CharSetT<CharT>& removedchars) const
+        {
+            return _map_views([&removedchars](const view_type str) {
+                const auto first{ std::find_if_not(str.begin(), str.end(), std::cref(removedchars)) };
+                const auto last{ std::find_if_not(str.rbegin(), std::make_reverse_iterator(first), std::cref(removedchars)).base() };
+                return view_type(first, last);
+            });
+        }
+
+        /** \brief Returns a column with the uppercase conversion of each string, as CppStringT::upper() does. */
+        [[nodiscard]]
+        StringColumnT upper() const
+        {
+            return _map_chars([](const CharT ch) { return string_type::upper(ch); });
+        }
+
+
+        //---   batch conversions   -------------------------
+        /** \brief Returns the floating-point number written in each string, as CppStringT::to_float() does. Raises ValueException as soon as a string is not a valid number. */
+        template<class FloatT = double>
+            requires std::floating_point<FloatT>
+        [[nodiscard]]
+        std::vector<FloatT> to_float() const
+        {
+            std::vector<FloatT> res(size());
+            for (size_type index = 0; index < size(); ++index) {
+                const std::expected<FloatT, std::errc> value{ pcs::try_to_float<FloatT>((*this)[index]) };
+                if (!value.has_value()) [[unlikely]]
+                    throw typename string_type::ValueException("could not convert string to float.");
+                res[index] = *value;
+            }
+            return res;
+        }
+
+        /** \brief Returns the integer written in base in each string, as CppStringT::to_int() does. Raises ValueException or std::out_of_range as soon as a string is not a valid integer. */
+        template<class IntT = int>
+            requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+        [[nodiscard]]
+        std::vector<IntT> to_int(const int base = 10) const
+        {
+            std::vector<IntT> res(size());
+            for (size_type index = 0; index < size(); ++index) {
+                const std::expected<IntT, std::errc> value{ pcs::try_to_int<IntT>((*this)[index], base) };
+                if (!value.has_value()) [[unlikely]] {
+                    if (value.error() == std::errc::result_out_of_range)
+                        throw std::out_of_range("int() result out of range.");
+                    throw typename string_type::ValueException(std::format("invalid literal for int() with base {}.", base));
+                }
+                res[index] = *value;
+            }
+            return res;
+        }
+
+        /** \brief Returns, for each string, the floating-point number written in it or an error code, as CppStringT::try_to_float() does. */
+        template<class FloatT = double>
+            requires std::floating_point<FloatT>
+        [[nodiscard]]
+        std::vector<std::expected<FloatT, std::errc>> try_to_float() const
+        {
+            std::vector<std::expected<FloatT, std::errc>> res{};
+            res.reserve(size());
+            for (size_type index = 0; index < size(); ++index)
+                res.push_back(pcs::try_to_float<FloatT>((*this)[index]));
+            return res;
+        }
+
+        /** \brief Returns, for each string, the integer written in it in base or an error code, as CppStringT::try_to_int() does. */
+        template<class IntT = int>
+            requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+        [[nodiscard]]
+        std::vector<std::expected<IntT, std::errc>> try_to_int(const int base = 10) const
+        {
+            std::vector<std::expected<IntT, std::errc>> res{};
+            res.reserve(size());
+            for (size_type index = 0; index < size(); ++index)
+                res.push_back(pcs::try_to_int<IntT>((*this)[index], base));
+            return res;
+        }
+
+
+    private:
+        std::vector<CharT> m_chars{};
+        std::vector<size_type> m_offsets{ 0 };
+
+        /** \brief Returns a column with the same offsets and with each character transformed by func, in one single pass over the buffer. */
+        template<class FuncT>
+        [[nodiscard]]
+        StringColumnT _map_chars(FuncT&& func) const
+        {
+            StringColumnT res{};
+            res.m_offsets = m_offsets;
+            res.m_chars.resize(m_chars.size());
+            std::transform(m_chars.cbegin(), m_chars.cend(), res.m_chars.begin(), std::forward<FuncT>(func));
+            return res;
+        }
+
+        /** \brief Returns a column with the views returned by func for each string, which are no longer than these strings. */
+        template<class FuncT>
+        [[nodiscard]]
+        StringColumnT _map_views(FuncT&& func) const
+        {
+            StringColumnT res{};
+            res.reserve(size(), m_chars.size());
+            for (size_type index = 0; index < size(); ++index)
+                res.push_back(func((*this)[index]));
+            return res;
+        }
+    };
+
+
+    //=====   Tables   ============================================
+    /** \brief The class of tables of strings, rendered as text with aligned columns.
+    *
+    * Rows of cells get added one after the other.  The cells are stored in
+    * one column of strings, and the width of each column of the table is
+    * updated as each row gets added, so that rendering needs no other pass
+    * over the cells. Each column is left, right or center aligned, left by
+    * default, and columns are separated with a separator string, a single
+    * space by default. Widths are counted in characters.
+    *
+    * All the rendered rows have the same length, missing cells of shorter
+    * rows being rendered as empty ones, and each row ends with a newline.
+    * The size of the rendered text is then known in advance:  the text is
+    * rendered into one single preallocated buffer.
+    *
+    * Example:
+    *   pcs::Table table({ pcs::Table::Align::LEFT, pcs::Table::Align::RIGHT });
+    *   table.add_row({ "apples", "3" });
+    *   table.add_row({ "kiwis", "12" });
+    *   pcs::CppString text{ table.str() };  // "apples  3\nkiwis  12\n"
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    class TableT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
+        using size_type   = std::size_t;
+        using view_type   = std::basic_string_view<CharT, TraitsT>;
+
+        enum class Align { LEFT, CENTER, RIGHT };               //!< Alignments of cells in their columns
+
+
+        //---   Constructors / Destructor   -------------------
+        inline TableT() noexcept = default;                    //!< Default constructor, empty table with left aligned columns
+
+        /** \brief Constructor with the alignments of the first columns, the other ones being left aligned. */
+        inline TableT(std::initializer_list<Align> aligns)
+            : m_aligns(aligns)
+        {}
+
+        /** \brief Constructor with the alignments of the first columns and with the separator of columns. */
+        inline TableT(std::initializer_list<Align> aligns, const view_type sep)
+            : m_aligns(aligns)
+            , m_sep(sep)
+        {}
+
+
+        //---   accessors   -----------------------------------
+        /** \brief Returns the view on the column-th cell of the row-th row, which is empty if this row has not that many cells. */
+        [[nodiscard]]
+        inline view_type cell(const size_type row, const size_type column) const noexcept
+        {
+            return (column < m_rows[row + 1] - m_rows[row]) ? m_cells[m_rows[row] + column] : view_type();
+        }
+
+        /** \brief Returns the count of columns of this table, i.e. the count of cells of its longest row. */
+        [[nodiscard]]
+        inline size_type columns_count() const noexcept
+        {
+            return m_widths.size();
+        }
+
+        /** \brief Returns the count of rows of this table. */
+        [[nodiscard]]
+        inline size_type rows_count() const noexcept
+        {
+            return m_rows.size() - 1;
+        }
+
+        /** \brief Returns the count of characters of the rendered text. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return rows_count() * _row_size();
+        }
+
+        /** \brief Returns the widths of the columns of this table. */
+        [[nodiscard]]
+        inline std::span<const size_type> widths() const noexcept
+        {
+            return std::span<const size_type>(m_widths);
+        }
+
+
+        //---   modifiers   -----------------------------------
+        /** \brief Appends a row with a list of cells. Returns a reference to this table. */
+        inline TableT& add_row(std::initializer_list<view_type> cells)
+        {
+            return add_row<std::initializer_list<view_type>>(cells);
+        }
+
+        /** \brief Appends a row with the cells of a range of strings. Returns a reference to this table. */
+        template<class RangeT>
+        TableT& add_row(const RangeT& cells)
+        {
+            size_type column{ 0 };
+            for (const auto& cell : cells) {
+                const view_type str(cell);
+                m_cells.push_back(str);
+                if (column == m_widths.size()) [[unlikely]]
+                    m_widths.push_back(str.size());
+                else if (str.size() > m_widths[column])
+                    m_widths[column] = str.size();
+                ++column;
+            }
+            m_rows.push_back(m_cells.size());
+            return *this;
+        }
+
+        /** \brief Removes all the rows of this table, keeping its alignments and its separator. */
+        inline void clear() noexcept
+        {
+            m_cells.clear();
+            m_rows.resize(1);
+            m_widths.clear();
+        }
+
+        /** \brief Reserves memory for rows_count rows with cells_count cells and chars_count characters in these cells overall. */
+        inline void reserve(const size_type rows_count, const size_type cells_count, const size_type chars_count)
+        {
+            m_rows.reserve(rows_count + 1);
+            m_cells.reserve(cells_count, chars_count);
+        }
+
+
+        //---   rendering   -----------------------------------
+        /** \brief Appends the rendered text to the passed string, with at most one reallocation of it. */
+        template<class OtherAllocatorT>
+        std::basic_string<CharT, TraitsT, OtherAllocatorT>& append_to(std::basic_string<CharT, TraitsT, OtherAllocatorT>& out) const
+        {
+            const size_type prev_size{ out.size() };
+            const size_type new_size{ prev_size + size() };
+#if defined(__cpp_lib_string_resize_and_overwrite)
+            out.resize_and_overwrite(new_size, [this, prev_size, new_size](CharT* chars, std::size_t) noexcept {
+                copy_to(chars + prev_size);
+                return new_size;
+            });
+#else
+            out.resize(new_size);
+            copy_to(out.data() + prev_size);
+#endif
+            return out;
+        }
+
+        /** \brief Copies the rendered text into dest, which must be big enough, i.e. at least size() characters long. Returns a pointer right after the last copied character. */
+        CharT* copy_to(CharT* dest) const noexcept
+        {
+            for (size_type row = 0; row < rows_count(); ++row) {
+                for (size_type column = 0; column < columns_count(); ++column) {
+                    if (column > 0) [[likely]]
+                        dest = std::copy(m_sep.cbegin(), m_sep.cend(), dest);
+
+                    const view_type str{ cell(row, column) };
+                    const size_type padding{ m_widths[column] - str.size() };
+                    const Align align{ column < m_aligns.size() ? m_aligns[column] : Align::LEFT };
+                    const size_type left_padding{ align == Align::LEFT ? 0 : align == Align::RIGHT ? padding : padding / 2 };
+                    dest = std::fill_n(dest, left_padding, CharT(' '));
+                    dest = std::copy(str.cbegin(), str.cend(), dest);
+                    dest = std::fill_n(dest, padding - left_padding, CharT(' '));
+                }
+                *dest++ = CharT('\n');
+            }
+            return dest;
+        }
+
+        /** \brief Renders this table into a new string, with one single allocation. */
+        [[nodiscard]]
+        inline string_type str() const
+        {
+            string_type res{};
+            append_to(res);
+            return res;
+        }
+
+
+    private:
+        StringColumnT<CharT, TraitsT> m_cells{};
+        std::vector<size_type> m_rows{ 0 };                     // index of the first cell of each row, plus the count of cells
+        std::vector<size_type> m_widths{};
+        std::vector<Align> m_aligns{};
+        string_type m_sep{ CharT(' ') };
+
+        /** \brief Returns the count of characters of each rendered row, newline included. */
+        [[nodiscard]]
+        inline size_type _row_size() const noexcept
+        {
+            return std::accumulate(m_widths.cbegin(), m_widths.cend(), size_type(0)) + (m_widths.empty() ? 0 : (m_widths.size() - 1) * m_sep.size()) + 1;
+        }
+    };
+
+
+    //=====   Numbers conversions   ===============================
+    /** \brief The class of the ASCII characters of numbers written in strings.
+    *
+    * These are the characters of a string with its leading and trailing
+    * whitespaces removed and with its sign removed, narrowed to char. The
+    * characters of char strings get referenced,  unless underscores have
+    * to be removed from them,  while the ones of the other strings get
+    * copied. Strings with non-ASCII characters are not valid numbers.
+    */
+    template<class CharT, class TraitsT>
+    class NumberCharsT
+    {
+    public:
+        //---   Constructors / Destructor   -------------------
+        /** \brief Constructor with the string of a number. */
+        explicit NumberCharsT(const std::basic_string_view<CharT, TraitsT> str)
+        {
+            static const CharSetT<CharT> whitespaces{ CharSetT<CharT>::whitespaces() };
+
+            auto first{ std::find_if_not(str.begin(), str.end(), std::cref(whitespaces)) };
+            const auto last{ std::find_if_not(str.rbegin(), std::make_reverse_iterator(first), std::cref(whitespaces)).base() };
+            if (first != last && (*first == CharT('-') || *first == CharT('+'))) {
+                m_negative = *first == CharT('-');
+                ++first;
+            }
+
+            if constexpr (std::is_same_v<CharT, char>) {
+                m_first = std::to_address(first);
+                m_last = std::to_address(last);
+            }
+            else {
+                m_buffer.resize(std::size_t(last - first));
+                for (char& ch : m_buffer) {
+                    if (std::make_unsigned_t<CharT>(*first) > 0x7f) [[unlikely]] {
+                        m_valid = false;
+                        break;
+                    }
+                    ch = char(*first++);
+                }
+                m_first = m_buffer.data();
+                m_last = m_first + m_buffer.size();
+            }
+        }
+
+
+        //---   accessors   -----------------------------------
+        [[nodiscard]] inline const char* begin() const noexcept { return m_first; }                 //!< Returns a pointer to the first character.
+        [[nodiscard]] inline const char* end() const noexcept { return m_last; }                    //!< Returns a pointer past the last character.
+        [[nodiscard]] inline bool empty() const noexcept { return m_first == m_last; }              //!< Returns true if there is no character, or false otherwise.
+        [[nodiscard]] inline bool negative() const noexcept { return m_negative; }                  //!< Returns true if the number has sign '-', or false otherwise.
+        [[nodiscard]] inline std::size_t size() const noexcept { return std::size_t(m_last - m_first); }  //!< Returns the count of characters.
+        [[nodiscard]] inline bool valid() const noexcept { return m_valid && m_first != m_last; }  //!< Returns true if there are characters, all ASCII, or false otherwise.
+
+
+        //---   modifiers   -----------------------------------
+        /** \brief Removes the underscores that separate digits, i.e. characters for which is_digit is true, from the characters past the skipped_count first ones.
+        *
+        * An underscore may also directly follow the skipped characters, i.e.
+        * a prefix of the number. Returns false if some other underscore is
+        * found, or true otherwise.
+        */
+        template<class IsDigitT>
+        bool remove_underscores(const std::size_t skipped_count, IsDigitT is_digit)
+        {
+            const char* const first{ m_first + skipped_count };
+            const char* underscore{ std::find(first, m_last, '_') };
+            if (underscore == m_last) [[likely]]
+                return true;
+
+            std::string chars(m_first, underscore);
+            for (const char* p = underscore; p != m_last; ++p) {
+                if (*p != '_')
+                    chars.push_back(*p);
+                else if ((p == first && skipped_count == 0) || (p != first && !is_digit(p[-1])) || p + 1 == m_last || !is_digit(p[1]))
+                    return false;
+            }
+            m_buffer = std::move(chars);
+            m_first = m_buffer.data();
+            m_last = m_first + m_buffer.size();
+            return true;
+        }
+
+
+    private:
+        std::string m_buffer{};
+        const char* m_first{ nullptr };
+        const char* m_last{ nullptr };
+        bool m_negative{ false };
+        bool m_valid{ true };
+    };
+
+
+    /** \brief Returns the integer written in str in base, as Python int() does, or an error code. See CppStringT::try_to_int().
+    *
+    * Fields of 8 or 16 decimal digits, the usual widths of identifiers and
+    * timestamps in columns of data, are converted eight digits at a time
+    * with arithmetic on 64-bits words, without any loop over their digits.
+    * All the other ones get converted by std::from_chars().
+    */
+    template<class IntT, class CharT, class TraitsT>
+        requires std::integral<IntT> && (!std::is_same_v<IntT, bool>)
+    std::expected<IntT, std::errc> try_to_int(const std::basic_string_view<CharT, TraitsT> str, int base)
+    {
+        using UIntT = std::make_unsigned_t<IntT>;
+
+        NumberCharsT<CharT, TraitsT> chars(str);
+        if (!chars.valid() || base == 1 || base < 0 || base > 36) [[unlikely]]
+            return std::unexpected(std::errc::invalid_argument);
+
+        // prefix
+        std::size_t prefix_size{ 0 };
+        if (chars.size() >= 2 && chars.begin()[0] == '0') {
+            const char prefix{ char(chars.begin()[1] | 0x20) };
+            const int prefix_base{ prefix == 'x' ? 16 : prefix == 'o' ? 8 : prefix == 'b' ? 2 : 0 };
+            if (prefix_base != 0 && (base == 0 || base == prefix_base)) {
+                base = prefix_base;
+                prefix_size = 2;
+            }
+        }
+        if (base == 0) {
+            base = 10;
+            if (chars.begin()[0] == '0' && std::any_of(chars.begin(), chars.end(), [](const char ch) { return ch != '0' && ch != '_'; }))
+                return std::unexpected(std::errc::invalid_argument);  // leading zeros, as with Python literals
+        }
+
+        if (!chars.remove_underscores(prefix_size, [](const char ch) { return ('0' <= ch && ch <= '9') || ('a' <= (ch | 0x20) && (ch | 0x20) <= 'z'); })) [[unlikely]]
+            return std::unexpected(std::errc::invalid_argument);
+
+        // magnitude
+        const char* const first{ chars.begin() + prefix_size };
+        const char* const last{ chars.end() };
+        const std::size_t digits_count{ std::size_t(last - first) };
+        UIntT magnitude{ 0 };
+
+        const auto eight_digits = [](const char* const digits, std::uint64_t& value) {
+            std::uint64_t word;
+            std::memcpy(&word, digits, sizeof(word));
+            if ((word & 0xf0f0f0f0f0f0f0f0) != 0x3030303030303030 || ((word + 0x0606060606060606) & 0xf0f0f0f0f0f0f0f0) != 0x3030303030303030)
+                return false;
+            word = (word & 0x0f0f0f0f0f0f0f0f) * 2561 >> 8;
+            word = (word & 0x00ff00ff00ff00ff) * 6553601 >> 16;
+            value = value * 100000000 + ((word & 0x0000ffff0000ffff) * 42949672960001 >> 32);
+            return true;
+        };
+
+        std::uint64_t fast_value{ 0 };
+        if (std::endian::native == std::endian::little && base == 10 && (digits_count == 8 || digits_count == 16) &&
+            eight_digits(first, fast_value) && (digits_count == 8 || eight_digits(first + 8, fast_value)))
+        {
+            if (fast_value > std::numeric_limits<UIntT>::max()) [[unlikely]]
+                return std::unexpected(std::errc::result_out_of_range);
+            magnitude = UIntT(fast_value);
+        }
+        else {
+            const auto [ptr, ec] { std::from_chars(first, last, magnitude, base) };
+            if (ec == std::errc::result_out_of_range && ptr == last) [[unlikely]]
+                return std::unexpected(std::errc::result_out_of_range);
+            if (ec != std::errc{} || ptr != last || digits_count == 0) [[unlikely]]
+                return std::unexpected(std::errc::invalid_argument);
+        }
+
+        // sign
+        if (chars.negative()) {
+            if (magnitude == 0)
+                return IntT(0);
+            if constexpr (std::is_unsigned_v<IntT>)
+                return std::unexpected(std::errc::result_out_of_range);
+            else {
+                if (magnitude - 1 > UIntT(std::numeric_limits<IntT>::max())) [[unlikely]]
+                    return std::unexpected(std::errc::result_out_of_range);
+                return IntT(-IntT(magnitude - 1) - 1);
+            }
+        }
+        if (magnitude > UIntT(std::numeric_limits<IntT>::max())) [[unlikely]]
+            return std::unexpected(std::errc::result_out_of_range);
+        return IntT(magnitude);
+    }
+
+
+    /** \brief Returns the floating-point number written in str, as Python float() does, or an error code. See CppStringT::try_to_float(). */
+    template<class FloatT, class CharT, class TraitsT>
+        requires std::floating_point<FloatT>
+    std::expected<FloatT, std::errc> try_to_float(const std::basic_string_view<CharT, TraitsT> str)
+    {
+        NumberCharsT<CharT, TraitsT> chars(str);
+        if (!chars.valid() || !chars.remove_underscores(0, [](const char ch) { return '0' <= ch && ch <= '9'; })) [[unlikely]]
+            return std::unexpected(std::errc::invalid_argument);
+
+        // std::from_chars() also accepts "nan(chars)", which Python does not
+        if (chars.end()[-1] == ')' || chars.begin()[0] == '-' || chars.begin()[0] == '+') [[unlikely]]
+            return std::unexpected(std::errc::invalid_argument);
+
+        FloatT value;
+        const auto [ptr, ec] { std::from_chars(chars.begin(), chars.end(), value) };
+        if (ptr != chars.end()) [[unlikely]]
+            return std::unexpected(std::errc::invalid_argument);
+        if (ec == std::errc::result_out_of_range) [[unlikely]] {
+            // underflows get rounded to zero and overflows to infinity, as Python does
+            std::int64_t magnitude_order{ 0 };          // decimal order of the first significant digit of the mantissa
+            bool point_seen{ false };
+            bool significant_seen{ false };
+            const char* p{ chars.begin() };
+            for (; p != chars.end() && (*p | 0x20) != 'e'; ++p) {
+                if (*p == '.')
+                    point_seen = true;
+                else if (significant_seen || *p != '0') {
+                    significant_seen = true;
+                    magnitude_order += !point_seen;
+                }
+                else if (point_seen)
+                    --magnitude_order;
+            }
+            std::int64_t exponent{ 0 };
+            if (p != chars.end() && std::from_chars(p + 1 + (p[1] == '+'), chars.end(), exponent).ec != std::errc{})
+                exponent = (p[1] == '-') ? std::numeric_limits<std::int32_t>::min() : std::numeric_limits<std::int32_t>::max();
+            value = (magnitude_order + exponent > 0) ? std::numeric_limits<FloatT>::infinity() : FloatT(0);
+        }
+        else if (ec != std::errc{}) [[unlikely]]
+            return std::unexpected(std::errc::invalid_argument);
+
+        return chars.negative() ? -value : value;
+    }
+
+
+    //=====   Hashing   ===========================================
+    /** \brief Returns the 64-bits hash value of size bytes at data, with the wyhash algorithm (final version 4, public domain).
+    *
+    * Inputs get hashed 16 or 48 bytes per round,  each round multiplying
+    * 64-bits words into 128-bits products that get folded back to 64 bits,
+    * with no per-byte processing.  Short inputs are hashed with a couple of
+    * overlapping reads. This hash passes the SMHasher tests. It is not
+    * meant to be a cryptographic hash.
+    */
+    [[nodiscard]]
+    inline std::uint64_t hash_bytes(const void* data, const std::size_t size, std::uint64_t seed) noexcept
+    {
+        const std::uint8_t* const bytes{ static_cast<const std::uint8_t*>(data) };
+        return hash_bytes([bytes](void* dest, const std::size_t offset, const std::size_t count) noexcept { std::memcpy(dest, bytes + offset, count); }, size, seed);
+    }
+
+
+    /** \brief Returns the 64-bits hash value of size bytes, as hash_bytes(data, size, seed) hashes them, the bytes being got with load(dest, offset, count).
+    *
+    * load() copies into dest the count bytes at offset, count being 1, 4 or
+    * 8. This lets bytes get transformed on the fly while they are hashed,
+    * e.g. case folded by IHashT, with no intermediate buffer.
+    */
+    template<class LoadT>
+        requires std::is_nothrow_invocable_v<const LoadT&, void*, std::size_t, std::size_t>
+    [[nodiscard]]
+    std::uint64_t hash_bytes(const LoadT& load, const std::size_t size, std::uint64_t seed) noexcept
+    {
+        static constexpr std::uint64_t secret[4]{ 0x2d358dccaa6c78a5ull, 0x8bb84b93962eacc9ull, 0x4b33a62ed433d4a3ull, 0x4d5a2da51de1aa47ull };
+
+        const auto mum = [](std::uint64_t& a, std::uint64_t& b) noexcept {
+#if defined(__SIZEOF_INT128__)
+            const unsigned __int128 product{ static_cast<unsigned __int128>(a) * b };
+            a = std::uint64_t(product);
+            b = std::uint64_t(product >> 64);
+#elif defined(_MSC_VER) && defined(_M_X64)
+            a = _umul128(a, b, &b);
+#else
+            const std::uint64_t ha{ a >> 32 }, hb{ b >> 32 }, la{ std::uint32_t(a) }, lb{ std::uint32_t(b) };
+            const std::uint64_t rh{ ha * hb }, rm0{ ha * lb }, rm1{ hb * la }, rl{ la * lb };
+            const std::uint64_t t{ rl + (rm0 << 32) };
+            const std::uint64_t lo{ t + (rm1 << 32) };
+            const std::uint64_t hi{ rh + (rm0 >> 32) + (rm1 >> 32) + (t < rl) + (lo < t) };
+            a = lo;
+            b = hi;
+#endif
+        };
+        const auto mix = [&mum](std::uint64_t a, std::uint64_t b) noexcept { mum(a, b); return a ^ b; };
+        const auto read8 = [&load](const std::size_t offset) noexcept { std::uint64_t v; load(&v, offset, 8); return v; };
+        const auto read4 = [&load](const std::size_t offset) noexcept { std::uint32_t v; load(&v, offset, 4); return std::uint64_t(v); };
+        const auto read1 = [&load](const std::size_t offset) noexcept { std::uint8_t v; load(&v, offset, 1); return std::uint64_t(v); };
+
+        std::size_t p{ 0 };     // offset of the next bytes to be hashed
+        seed ^= mix(seed ^ secret[0], secret[1]);
+        std::uint64_t a, b;
+        if (size <= 16) [[likely]] {
+            if (size >= 4) [[likely]] {
+                a = (read4(p) << 32) | read4(p + ((size >> 3) << 2));
+                b = (read4(p + size - 4) << 32) | read4(p + size - 4 - ((size >> 3) << 2));
+            }
+            else if (size > 0) {
+                a = (read1(0) << 16) | (read1(size >> 1) << 8) | read1(size - 1);
+                b = 0;
+            }
+            else
+                a = b = 0;
+        }
+        else {
+            std::size_t remaining{ size };
+            if (remaining > 48) {
+                std::uint64_t seed1{ seed }, seed2{ seed };
+                do {
+                    seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                    seed1 = mix(read8(p + 16) ^ secret[2], read8(p + 24) ^ seed1);
+                    seed2 = mix(read8(p + 32) ^ secret[3], read8(p + 40) ^ seed2);
+                    p += 48;
+                    remaining -= 48;
+                } while (remaining > 48);
+                seed ^= seed1 ^ seed2;
+            }
+            while (remaining > 16) {
+                seed = mix(read8(p) ^ secret[1], read8(p + 8) ^ seed);
+                p += 16;
+                remaining -= 16;
+            }
+            a = read8(p + remaining - 16);
+            b = read8(p + remaining - 8);
+        }
+        a ^= secret[1];
+        b ^= seed;
+        mum(a, b);
+        return mix(a ^ secret[0] ^ size, b ^ secret[1]);
+    }
+
+
+    /** \brief The class of transparent hashing functors of strings, as hash_bytes() hashes their characters.
+    *
+    * Strings, CppStringT, views and null-terminated strings get all hashed
+    * the same way, so that unordered containers declared with HashT  and
+    * EqualT get searched with any of them as keys without building any
+    * temporary key. CppHashedStringT gets its cached hash value returned.
+    *
+    * Example:
+    *   std::unordered_map<pcs::CppString, int, pcs::Hash, pcs::Equal> counts;
+    *   const auto it{ counts.find("key") };    // no temporary CppString
+    */
+    template<class CharT, class TraitsT>
+    struct HashT
+    {
+        using is_transparent = void;                            //!< enables heterogeneous lookups
+
+        /** \brief Returns the hash value of the viewed characters. */
+        [[nodiscard]]
+        inline std::size_t operator() (const std::basic_string_view<CharT, TraitsT> str) const noexcept
+        {
+            return std::size_t(hash_bytes(str.data(), str.size() * sizeof(CharT)));
+        }
+
+        /** \brief Returns the hash value cached by the hashed string. */
+        template<class AllocatorT>
+        [[nodiscard]]
+        inline std::size_t operator() (const CppHashedStringT<CharT, TraitsT, AllocatorT>& str) const noexcept
+        {
+            return str.hash();
+        }
+    };
+
+
+    /** \brief The class of transparent equality functors of strings, to be used along with HashT. */
+    template<class CharT, class TraitsT>
+    struct EqualT
+    {
+        using is_transparent = void;                            //!< enables heterogeneous lookups
+
+        /** \brief Returns true if both views view the same characters, or false otherwise. */
+        [[nodiscard]]
+        inline bool operator() (const std::basic_string_view<CharT, TraitsT> left, const std::basic_string_view<CharT, TraitsT> right) const noexcept
+        {
+            return left == right;
+        }
+    };
+
+
+    /** \brief The class of immutable strings that cache their hash value.
+    *
+    * The hash value is computed on the first call to hash(), as HashT does,
+    * and is then returned at no cost. Two hashed strings with both hashes
+    * already computed get compared by their hashes first. Hashed strings
+    * are the keys to be used in unordered containers that are searched
+    * again and again with the same keys, e.g. keys parsed once from data.
+    * Hash values get cached atomically:  hashed strings may be shared by
+    * several threads.
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    class CppHashedStringT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
+        using size_type   = typename string_type::size_type;
+        using view_type   = std::basic_string_view<CharT, TraitsT>;
+
+
+        //---   Constructors / Destructor   -------------------
+        inline CppHashedStringT() noexcept = default;          //!< Default constructor, empty string
+
+        /** \brief Constructor with a copy of the viewed characters. */
+        inline explicit CppHashedStringT(const view_type str)
+            : m_str(str.data(), str.size())
+        {}
+
+        /** \brief Constructor with a copy of a null-terminated string. */
+        inline explicit CppHashedStringT(const CharT* str)
+            : m_str(str)
+        {}
+
+        /** \brief Constructor with a string, which gets moved when passed as an rvalue. */
+        inline explicit CppHashedStringT(string_type str) noexcept
+            : m_str(std::move(str))
+        {}
+
+        /** \brief Copy constructor, copies the cached hash value too. */
+        inline CppHashedStringT(const CppHashedStringT& other)
+            : m_str(other.m_str)
+        {
+            _copy_hash(other);
+        }
+
+        /** \brief Move constructor, copies the cached hash value too. */
+        inline CppHashedStringT(CppHashedStringT&& other) noexcept
+            : m_str(std::move(other.m_str))
+        {
+            _copy_hash(other);
+            other.m_hashed.store(false, std::memory_order_relaxed);
+        }
+
+        inline ~CppHashedStringT() noexcept = default;         //!< Default destructor.
+
+        /** \brief Copy assignment, copies the cached hash value too. */
+        inline CppHashedStringT& operator= (const CppHashedStringT& other)
+        {
+            if (this != &other) [[likely]] {
+                m_str = other.m_str;
+                _copy_hash(other);
+            }
+            return *this;
+        }
+
+        /** \brief Move assignment, copies the cached hash value too. */
+        inline CppHashedStringT& operator= (CppHashedStringT&& other) noexcept
+        {
+            if (this != &other) [[likely]] {
+                m_str = std::move(other.m_str);
+                _copy_hash(other);
+                other.m_hashed.store(false, std::memory_order_relaxed);
+            }
+            return *this;
+        }
+
+
+        //---   accessors   -----------------------------------
+        /** \brief Returns a pointer to the null-terminated characters. */
+        [[nodiscard]]
+        inline const CharT* c_str() const noexcept
+        {
+            return m_str.c_str();
+        }
+
+        /** \brief Returns true if the string is empty, or false otherwise. */
+        [[nodiscard]]
+        inline bool empty() const noexcept
+        {
+            return m_str.empty();
+        }
+
+        /** \brief Returns the hash value of the string, computed on first call only. */
+        [[nodiscard]]
+        inline std::size_t hash() const noexcept
+        {
+            if (m_hashed.load(std::memory_order_acquire)) [[likely]]
+                return m_hash.load(std::memory_order_relaxed);
+
+            const std::size_t hash{ HashT<CharT, TraitsT>{}(view_type(m_str)) };
+            m_hash.store(hash, std::memory_order_relaxed);
+            m_hashed.store(true, std::memory_order_release);
+            return hash;
+        }
+
+        /** \brief Returns the count of characters of the string. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_str.size();
+        }
+
+        /** \brief Returns a reference to the string. */
+        [[nodiscard]]
+        inline const string_type& str() const noexcept
+        {
+            return m_str;
+        }
+
+        /** \brief Returns a view on the string. */
+        [[nodiscard]]
+        inline view_type view() const noexcept
+        {
+            return view_type(m_str);
+        }
+
+        /** \brief Implicit conversion to string views. */
+        [[nodiscard]]
+        inline operator view_type() const noexcept
+        {
+            return view_type(m_str);
+        }
+
+
+        //---   comparisons   ---------------------------------
+        /** \brief Returns true if both strings are equal, comparing first their hash values when both are already computed. */
+        [[nodiscard]]
+        inline bool operator== (const CppHashedStringT& other) const noexcept
+        {
+            if (m_hashed.load(std::memory_order_acquire) && other.m_hashed.load(std::memory_order_acquire) &&
+                m_hash.load(std::memory_order_relaxed) != other.m_hash.load(std::memory_order_relaxed))
+                return false;
+            return m_str == other.m_str;
+        }
+
+        /** \brief Returns true if this string views the same characters as the view, or false otherwise. */
+        [[nodiscard]]
+        inline bool operator== (const view_type other) const noexcept
+        {
+            return view_type(m_str) == other;
+        }
+
+        /** \brief Compares this string with another one, in lexicographical order. */
+        [[nodiscard]]
+        inline auto operator<=> (const CppHashedStringT& other) const noexcept
+        {
+            return view_type(m_str) <=> view_type(other.m_str);
+        }
+
+
+    private:
+        string_type m_str{};
+        mutable std::atomic<std::size_t> m_hash{ 0 };
+        mutable std::atomic<bool> m_hashed{ false };
+
+        /** \brief Copies the cached hash value of other, if any. */
+        inline void _copy_hash(const CppHashedStringT& other) noexcept
+        {
+            const bool hashed{ other.m_hashed.load(std::memory_order_acquire) };
+            m_hash.store(other.m_hash.load(std::memory_order_relaxed), std::memory_order_relaxed);
+            m_hashed.store(hashed, std::memory_order_release);
+        }
+    };
+
+
+    //=====   Case-insensitive comparisons   ======================
+    /** \brief The class of transparent case-insensitive equality functors of strings.
+    *
+    * Characters get compared via their case folded forms, see fold_case(),
+    * without any copy of the strings. Characters of char strings get folded
+    * and compared eight at a time within 64-bits words.
+    *
+    * Example:
+    *   std::unordered_map<pcs::CppString, int, pcs::IHash, pcs::IEqual> ids;
+    *   ids["Content-Type"] = 1;
+    *   const auto it{ ids.find("content-type") };   // found, nothing allocated
+    */
+    template<class CharT, class TraitsT>
+    struct IEqualT
+    {
+        using is_transparent = void;                            //!< enables heterogeneous lookups
+
+        /** \brief Returns true if both views are equal once case folded, or false otherwise. */
+        [[nodiscard]]
+        inline bool operator() (const std::basic_string_view<CharT, TraitsT> left, const std::basic_string_view<CharT, TraitsT> right) const noexcept
+        {
+            return left.size() == right.size() && equal_n(left.data(), right.data(), left.size());
+        }
+
+        /** \brief Returns true if the count first characters at left and at right are equal once case folded, or false otherwise. */
+        [[nodiscard]]
+        static bool equal_n(const CharT* left, const CharT* right, std::size_t count) noexcept
+        {
+            if constexpr (sizeof(CharT) == 1) {
+                for (; count >= 8; count -= 8, left += 8, right += 8) {
+                    std::uint64_t left_word, right_word;
+                    std::memcpy(&left_word, left, 8);
+                    std::memcpy(&right_word, right, 8);
+                    if (left_word != right_word && fold_ascii_case(left_word) != fold_ascii_case(right_word))
+                        return false;
+                }
+            }
+            for (; count > 0; --count)
+                if (fold_case(*left++) != fold_case(*right++))
+                    return false;
+            return true;
+        }
+    };
+
+
+    /** \brief The class of transparent case-insensitive hashing functors of strings, to be used along with IEqualT.
+    *
+    * The hash value of a string is the one of its case folded form, as HashT
+    * computes it, whatever the length of the string.  Characters get folded
+    * on the fly while hash_bytes() loads them, with no copy of the string:
+    * chars get folded eight at a time within 64-bits words, and wider
+    * characters one after the other.
+    */
+    template<class CharT, class TraitsT>
+    struct IHashT
+    {
+        using is_transparent = void;                            //!< enables heterogeneous lookups
+
+        /** \brief Returns the hash value of the case folded viewed characters. */
+        [[nodiscard]]
+        std::size_t operator() (const std::basic_string_view<CharT, TraitsT> str) const noexcept
+        {
+            const CharT* const chars{ str.data() };
+            const auto load_folded = [chars](void* dest, const std::size_t offset, const std::size_t count) noexcept {
+                if constexpr (sizeof(CharT) == 1) {
+                    std::uint64_t word{ 0 };
+                    std::memcpy(&word, chars + offset, count);
+                    word = fold_ascii_case(word);
+                    std::memcpy(dest, &word, count);    // fold_ascii_case() folds each byte in place
+                }
+                else {
+                    // folds the characters that cover the count bytes at offset, which may start or end within a character
+                    constexpr std::size_t MAX_CHARS{ 8 / sizeof(CharT) + 1 };
+                    CharT folded[MAX_CHARS];
+                    const std::size_t first{ offset / sizeof(CharT) };
+                    const std::size_t last{ (offset + count - 1) / sizeof(CharT) };
+                    for (std::size_t index = first; index <= last; ++index)
+                        folded[index - first] = fold_case(chars[index]);
+                    std::memcpy(dest, reinterpret_cast<const std::uint8_t*>(folded) + offset % sizeof(CharT), count);
+                }
+            };
+            return std::size_t(hash_bytes(load_folded, str.size() * sizeof(CharT), 0));
+        }
+    };
+
+
+    /** \brief The class of transparent case-insensitive ordering functors of strings, for ordered containers.
+    *
+    * Strings get ordered by the lexicographical order of their case folded
+    * characters,  as compared by TraitsT::lt().  Common prefixes of char
+    * strings get skipped eight characters at a time.
+    */
+    template<class CharT, class TraitsT>
+    struct ILessT
+    {
+        using is_transparent = void;                            //!< enables heterogeneous lookups
+
+        /** \brief Returns true if left is less than right once both are case folded, or false otherwise. */
+        [[nodiscard]]
+        bool operator() (const std::basic_string_view<CharT, TraitsT> left, const std::basic_string_view<CharT, TraitsT> right) const noexcept
+        {
+            const std::size_t count{ std::min(left.size(), right.size()) };
+            std::size_t index{ 0 };
+            if constexpr (sizeof(CharT) == 1) {
+                for (; index + 8 <= count; index += 8) {
+                    std::uint64_t left_word, right_word;
+                    std::memcpy(&left_word, left.data() + index, 8);
+                    std::memcpy(&right_word, right.data() + index, 8);
+                    if (left_word != right_word && fold_ascii_case(left_word) != fold_ascii_case(right_word))
+                        break;
+                }
+            }
+            for (; index < count; ++index) {
+                const CharT left_ch{ fold_case(left[index]) };
+                const CharT right_ch{ fold_case(right[index]) };
+                if (!TraitsT::eq(left_ch, right_ch))
+                    return TraitsT::lt(left_ch, right_ch);
+            }
+            return left.size() < right.size();
+        }
+    };
+
+
+    //=====   Strings sorting   ===================================
+    /** \brief The class of sorters of strings, with a multikey quicksort of their views.
+    *
+    * Multikey quicksort (Bentley & Sedgewick) partitions strings into the
+    * ones that are less than, equal to and greater than a pivot on their
+    * characters at some depth, and only the equal ones get compared on
+    * their next characters: common prefixes are compared once per pass,
+    * rather than once per comparison as with std::sort().
+    *
+    * Each string gets cached within its entry the next few characters to
+    * be compared, packed into a 64-bits word along with their count, so
+    * that partitions compare integers without any access to the strings
+    * characters. Caches get refreshed only for the strings with equal ones.
+    *
+    * Parallel sorts first cut strings into buckets bounded by splitters
+    * sampled from the strings,  then sort the buckets on several threads,
+    * starting at the common prefix of the bounds of each bucket.
+    *
+    * Sorters keep views of the sorted strings,  which must then outlive
+    * their sorter. Sorted views and the initial indexes of their strings
+    * are accessed via operator[] and index().
+    */
+    template<class CharT, class TraitsT>
+    class StringsSorterT
+    {
+    public:
+        //---   wrappers   ------------------------------------
+        using view_type = std::basic_string_view<CharT, TraitsT>;
+        using size_type = std::size_t;
+
+
+        //---   Constructors / Destructor   -------------------
+        /** \brief Constructor, from a random access range of strings or of views, e.g. std::vector<CppString>. */
+        template<class RangeT>
+            requires std::ranges::random_access_range<const RangeT> && std::convertible_to<std::ranges::range_reference_t<const RangeT>, view_type>
+        explicit StringsSorterT(const RangeT& strings)
+        {
+            m_items.reserve(std::ranges::size(strings));
+            size_type index{ 0 };
+            for (const auto& str : strings) {
+                const view_type view(str);
+                m_items.push_back({ view.data(), view.size(), _cache_at(view.data(), view.size(), 0), index++ });
+            }
+        }
+
+
+        //---   sorting   -------------------------------------
+        /** \brief Sorts the strings on the calling thread. When stable is true, equal strings keep their relative order. */
+        void sort(const bool stable = false)
+        {
+            _sort(m_items.data(), m_items.data() + m_items.size(), 0, stable);
+        }
+
+        /** \brief Sorts the strings on threads_count threads (0 stands for the count of hardware threads), as sort() does. */
+        void sort_parallel(const bool stable = false, const size_type threads_count = 0)
+        {
+            const size_type buckets_count{ parallel_chunks_count(m_items.size(), threads_count, PARALLEL_MIN_ITEMS) };
+            if (buckets_count <= 1) {
+                sort(stable);
+                return;
+            }
+
+            // splitters get sampled evenly from the strings
+            std::vector<view_type> samples(buckets_count * OVERSAMPLING);
+            for (size_type sample = 0; sample < samples.size(); ++sample)
+                samples[sample] = _view(m_items[sample * m_items.size() / samples.size()]);
+            std::sort(samples.begin(), samples.end());
+            std::vector<view_type> splitters(buckets_count - 1);
+            for (size_type bucket = 0; bucket < splitters.size(); ++bucket)
+                splitters[bucket] = samples[(bucket + 1) * OVERSAMPLING - 1];
+
+            // strings greater than splitters[b - 1] and not greater than splitters[b] go into bucket b
+            std::vector<std::uint32_t> buckets(m_items.size());
+            parallel_for_chunks(m_items.size(), buckets_count, [&](const size_type, const size_type first, const size_type last) {
+                for (size_type index = first; index < last; ++index)
+                    buckets[index] = std::uint32_t(std::upper_bound(splitters.cbegin(), splitters.cend(), _view(m_items[index])) - splitters.cbegin());
+            });
+
+            std::vector<size_type> offsets(buckets_count + 1, 0);
+            for (const std::uint32_t bucket : buckets)
+                ++offsets[bucket + 1];
+            std::partial_sum(offsets.cbegin(), offsets.cend(), offsets.begin());
+            std::vector<Item> items(m_items.size());
+            std::vector<size_type> positions(offsets.cbegin(), offsets.cend() - 1);
+            for (size_type index = 0; index < m_items.size(); ++index)   // keeps initial order within buckets
+                items[positions[buckets[index]]++] = m_items[index];
+            m_items = std::move(items);
+
+            parallel_for_chunks(buckets_count, buckets_count, [&](const size_type, const size_type first, const size_type last) {
+                for (size_type bucket = first; bucket < last; ++bucket) {
+                    size_type depth{ 0 };
+                    if (bucket > 0 && bucket < splitters.size()) {
+                        const view_type& low{ splitters[bucket - 1] };
+                        const view_type& high{ splitters[bucket] };
+                        const size_type count{ std::min(low.size(), high.size()) };
+                        while (depth < count && TraitsT::eq(low[depth], high[depth]))
+                            ++depth;
+                    }
+                    Item* const bucket_first{ m_items.data() + offsets[bucket] };
+                    Item* const bucket_last{ m_items.data() + offsets[bucket + 1] };
+                    if (depth > 0)
+                        for (Item* item = bucket_first; item != bucket_last; ++item)
+                            item->cache = _cache_at(item->data, item->size, depth);
+                    _sort(bucket_first, bucket_last, depth, stable);
+                }
+            });
+        }
+
+
+        //---   accessors   -----------------------------------
+        /** \brief Returns the view of the rank-th string, in sorted order once sorted. */
+        [[nodiscard]]
+        inline view_type operator[] (const size_type rank) const noexcept
+        {
+            return _view(m_items[rank]);
+        }
+
+        /** \brief Returns the initial index of the rank-th string, in sorted order once sorted. */
+        [[nodiscard]]
+        inline size_type index(const size_type rank) const noexcept
+        {
+            return m_items[rank].index;
+        }
+
+        /** \brief Returns the count of strings. */
+        [[nodiscard]]
+        inline size_type size() const noexcept
+        {
+            return m_items.size();
+        }
+
+
+    private:
+        struct Item
+        {
+            const CharT* data;
+            size_type size;
+            std::uint64_t cache;                                //!< next characters to be compared, big-endian, with their count in the low byte
+            size_type index;
+        };
+
+        struct Task
+        {
+            Item* first;
+            Item* last;
+            size_type depth;
+        };
+
+        static constexpr size_type CACHED_COUNT{ 7 / sizeof(CharT) };      //!< count of characters cached per string, the low byte of caches being their actual count
+        static constexpr size_type INSERTION_SORT_MAX{ 16 };
+        static constexpr size_type OVERSAMPLING{ 32 };
+
+        std::vector<Item> m_items{};
+
+
+        /** \brief Returns the cache of the string of size characters at data, for its characters at depth. */
+        [[nodiscard]]
+        static inline std::uint64_t _cache_at(const CharT* const data, const size_type size, const size_type depth) noexcept
+        {
+            using uchar_type = std::make_unsigned_t<CharT>;
+            constexpr unsigned CHAR_BITS{ 8 * sizeof(CharT) };
+
+            const size_type count{ (depth < size) ? std::min(size - depth, CACHED_COUNT) : 0 };
+#if defined(__cpp_lib_byteswap)
+            if constexpr (sizeof(CharT) == 1 && std::endian::native == std::endian::little) {
+                if (count == CACHED_COUNT && size - depth >= 8) [[likely]] {
+                    std::uint64_t word;
+                    std::memcpy(&word, data + depth, 8);
+                    return (std::byteswap(word) & ~std::uint64_t(0xff)) | CACHED_COUNT;
+                }
+            }
+#endif
+            std::uint64_t cache{ count };
+            for (size_type rank = 0; rank < count; ++rank)
+                cache |= std::uint64_t(uchar_type(data[depth + rank])) << (64 - CHAR_BITS * (rank + 1));
+            return cache;
+        }
+
+        /** \brief Returns true if the string of left is less than the one of right, both being equal up to depth, or false otherwise. */
+        [[nodiscard]]
+        static inline bool _less(const Item& left, const Item& right, const size_type depth, const bool stable) noexcept
+        {
+            if (left.cache != right.cache)
+                return left.cache < right.cache;
+            if ((left.cache & 0xff) == CACHED_COUNT) {
+                const size_type next{ depth + CACHED_COUNT };
+                const int cmp{ view_type(left.data + next, left.size - next).compare(view_type(right.data + next, right.size - next)) };
+                if (cmp != 0)
+                    return cmp < 0;
             }
-            else if (_stop > str_size)
-                _stop = str_size;
+            return stable && left.index < right.index;
+        }
 
-            if (_step == DEFAULT) [[likely]]
-                _step = 1;
-            if (_step < 0) [[unlikely]] {
-                if (_start <= _stop)
-                    _step = 0;  // will force end() to true
-            }
-            else [[unlikely]] {
-                if (_start >= _stop)
-                    _step = 0;  // will force end() to true
+        /** \brief Returns the median of the three caches. */
+        [[nodiscard]]
+        static inline std::uint64_t _median(const std::uint64_t a, const std::uint64_t b, const std::uint64_t c) noexcept
+        {
+            return std::max(std::min(a, b), std::min(std::max(a, b), c));
+        }
+
+        /** \brief Sorts the items in [first, last), whose strings are all equal up to depth and whose caches are the ones at depth. */
+        static void _sort(Item* const first, Item* const last, const size_type depth, const bool stable)
+        {
+            std::vector<Task> tasks{ { first, last, depth } };
+            while (!tasks.empty()) {
+                const Task task{ tasks.back() };
+                tasks.pop_back();
+                const size_type count(task.last - task.first);
+
+                if (count <= INSERTION_SORT_MAX) {
+                    for (Item* item = task.first + 1; item < task.last; ++item) {
+                        const Item moved{ *item };
+                        Item* hole{ item };
+                        for (; hole != task.first && _less(moved, hole[-1], task.depth, stable); --hole)
+                            *hole = hole[-1];
+                        *hole = moved;
+                    }
+                    continue;
+                }
+
+                // pivot: median of three, or pseudo-median of nine for large partitions
+                const Item* const items{ task.first };
+                std::uint64_t pivot;
+                if (count < 128)
+                    pivot = _median(items[0].cache, items[count / 2].cache, items[count - 1].cache);
+                else {
+                    const size_type step{ count / 8 };
+                    pivot = _median(_median(items[0].cache, items[step].cache, items[2 * step].cache),
+                                    _median(items[3 * step].cache, items[4 * step].cache, items[5 * step].cache),
+                                    _median(items[6 * step].cache, items[7 * step].cache, items[count - 1].cache));
+                }
+
+                // three-way partition: [first, less) < pivot, [less, greater) == pivot, [greater, last) > pivot
+                Item* less{ task.first };
+                Item* greater{ task.last };
+                for (Item* item = task.first; item < greater; ) {
+                    if (item->cache < pivot)
+                        std::swap(*less++, *item++);
+                    else if (item->cache > pivot)
+                        std::swap(*item, *--greater);
+                    else
+                        ++item;
+                }
+
+                tasks.push_back({ task.first, less, task.depth });
+                tasks.push_back({ greater, task.last, task.depth });
+                if ((pivot & 0xff) == CACHED_COUNT) {
+                    // equal strings so far: their next characters get compared
+                    const size_type next_depth{ task.depth + CACHED_COUNT };
+                    for (Item* item = less; item != greater; ++item)
+                        item->cache = _cache_at(item->data, item->size, next_depth);
+                    tasks.push_back({ less, greater, next_depth });
+                }
+                else if (stable)
+                    std::sort(less, greater, [](const Item& left, const Item& right) { return left.index < right.index; });
             }
+        }
 
-            return _index = _start;
+        /** \brief Returns the view of the string of item. */
+        [[nodiscard]]
+        static inline view_type _view(const Item& item) noexcept
+        {
+            return view_type(item.data, item.size);
         }
     };
 
 
-    /** \brief Class of slices with default stop and step values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    struct StartSlice : public Slice<IntT>
+    /** \brief Sorts strings in lexicographical order, with a multikey quicksort, see StringsSorterT.
+    *
+    * Meant for large amounts of strings,  and especially for strings that
+    * share long common prefixes, e.g. URLs or paths, which get compared
+    * once per pass rather than once per comparison. When stable is true,
+    * equal strings keep their relative order.
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    void sort_strings(std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings, const bool stable)
     {
-        using MyBaseClass = Slice<IntT>;
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
 
-        //---   Constructors / Destructor   -------------------
-        inline StartSlice(const IntT start = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
-            : MyBaseClass(start, MyBaseClass::DEFAULT, 1)
-        {}
+        StringsSorterT<CharT, TraitsT> sorter(strings);
+        sorter.sort(stable);
 
-        virtual ~StartSlice() noexcept = default;  //!< Default destructor.
-    };
+        std::vector<string_type> sorted{};
+        sorted.reserve(strings.size());
+        for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+            sorted.push_back(std::move(strings[sorter.index(rank)]));
+        strings = std::move(sorted);
+    }
 
+    /** \brief Sorts views in lexicographical order, with a multikey quicksort, see StringsSorterT. */
+    template<class CharT, class TraitsT>
+    void sort_strings(std::vector<std::basic_string_view<CharT, TraitsT>>& views, const bool stable)
+    {
+        StringsSorterT<CharT, TraitsT> sorter(views);
+        sorter.sort(stable);
 
-    /** \brief Class of slices with default start and step values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    struct StopSlice : public Slice<IntT>
+        for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+            views[rank] = sorter[rank];
+    }
+
+#if defined(PCS_EXECUTION_POLICIES)
+    /** \brief Sorts strings in lexicographical order, on threads_count threads (0 stands for the count of hardware threads) when policy is std::execution::par or par_unseq.
+    *
+    * Strings get moved into their sorted places, never copied. Other
+    * policies run sort_strings(strings, stable) on the calling thread.
+    */
+    template<class ExecutionPolicyT, class CharT, class TraitsT, class AllocatorT>
+        requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+    void sort_strings(ExecutionPolicyT&&, std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings, const bool stable, const std::size_t threads_count)
     {
-        using MyBaseClass = Slice<IntT>;
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
 
-        //---   Constructors / Destructor   -------------------
-        inline StopSlice(const IntT stop = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
-            : MyBaseClass(MyBaseClass::DEFAULT, stop, 1)
-        {}
+        if constexpr (!is_parallel_policy_v<ExecutionPolicyT>) {
+            sort_strings(strings, stable);
+            return;
+        }
 
-        virtual ~StopSlice() noexcept = default;  //!< Default destructor.
-    };
+        StringsSorterT<CharT, TraitsT> sorter(strings);
+        sorter.sort_parallel(stable, threads_count);
 
+        std::vector<string_type> sorted{};
+        sorted.reserve(strings.size());
+        for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+            sorted.push_back(std::move(strings[sorter.index(rank)]));
+        strings = std::move(sorted);
+    }
 
-    /** \brief Class of slices with default start and stop values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    struct StepSlice : public Slice<IntT>
+    /** \brief Sorts views in lexicographical order, on threads_count threads (0 stands for the count of hardware threads) when policy is std::execution::par or par_unseq. */
+    template<class ExecutionPolicyT, class CharT, class TraitsT>
+        requires std::is_execution_policy_v<std::remove_cvref_t<ExecutionPolicyT>>
+    void sort_strings(ExecutionPolicyT&&, std::vector<std::basic_string_view<CharT, TraitsT>>& views, const bool stable, const std::size_t threads_count)
     {
-        using MyBaseClass = Slice<IntT>;
+        if constexpr (!is_parallel_policy_v<ExecutionPolicyT>) {
+            sort_strings(views, stable);
+            return;
+        }
 
-        //---   Constructors / Destructor   -------------------
-        inline StepSlice(const IntT step = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
-            : MyBaseClass(MyBaseClass::DEFAULT, MyBaseClass::DEFAULT, step)
-        {}
+        StringsSorterT<CharT, TraitsT> sorter(views);
+        sorter.sort_parallel(stable, threads_count);
 
-        virtual ~StepSlice() noexcept = default;  //!< Default destructor.
-    };
+        for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+            views[rank] = sorter[rank];
+    }
+#endif
 
 
-    /** \brief Class of slices with default step values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    struct StartStopSlice : public Slice<IntT>
+    //=====   Collation   =========================================
+    /** \brief Sorts strings in the order of their collation keys, see method CppStringT::sort_key().
+    *
+    * The key of each string gets computed once only, rather than once per
+    * comparison, then keys get sorted by a StringsSorter, and finally the
+    * strings get moved into their new places.
+    * Sorting is stable: equal strings keep their relative order.
+    *
+    * Example:
+    *   std::vector<pcs::CppString> files{ "file10.txt", "File2.txt", "file1.txt" };
+    *   pcs::sort_by_key(files, true);   // "file1.txt", "File2.txt", "file10.txt"
+    */
+    template<class CharT, class TraitsT, class AllocatorT>
+    void sort_by_key(std::vector<CppStringT<CharT, TraitsT, AllocatorT>>& strings, const bool natural)
     {
-        using MyBaseClass = Slice<IntT>;
-
-        //---   Constructors / Destructor   -------------------
-        inline StartStopSlice(const IntT start = MyBaseClass::DEFAULT, const IntT stop = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
-            : MyBaseClass(start, stop, 1)
-        {}
-
-        virtual ~StartStopSlice() noexcept = default;  //!< Default destructor.
-    };
+        using string_type = CppStringT<CharT, TraitsT, AllocatorT>;
+
+        std::vector<std::string> keys{};
+        keys.reserve(strings.size());
+        for (const string_type& str : strings)
+            keys.push_back(str.sort_key(natural));
+        StringsSorter sorter(keys);
+        sorter.sort(true);
+
+        std::vector<string_type> sorted{};
+        sorted.reserve(strings.size());
+        for (std::size_t rank = 0; rank < sorter.size(); ++rank)
+            sorted.push_back(std::move(strings[sorter.index(rank)]));
+        strings = std::move(sorted);
+    }
 
 
-    /** \brief Class of slices with default stop values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    struct StartStepSlice : public Slice<IntT>
+    //=====   Parallel processing   ===============================
+    /** \brief Returns the count of chunks a range of count items gets cut into, to be processed in parallel.
+    *
+    * This is threads_count, or the count of hardware threads when 0, but
+    * reduced so that each chunk gets at least min_chunk_size items, since
+    * starting a thread costs much more than processing a few items.
+    */
+    [[nodiscard]]
+    inline std::size_t parallel_chunks_count(const std::size_t count, std::size_t threads_count, const std::size_t min_chunk_size) noexcept
     {
-        using MyBaseClass = Slice<IntT>;
+        if (threads_count == 0)
+            threads_count = std::max(std::size_t(std::thread::hardware_concurrency()), std::size_t(1));
+        return std::clamp(count / std::max(min_chunk_size, std::size_t(1)), std::size_t(1), threads_count);
+    }
 
-        //---   Constructors / Destructor   -------------------
-        inline StartStepSlice(const IntT start = MyBaseClass::DEFAULT, const IntT step = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
-            : MyBaseClass(start, MyBaseClass::DEFAULT, step)
-        {}
+    /** \brief Runs func(chunk, first, last) on each of the chunks_count consecutive chunks [first, last) of range [0, count), each chunk on its own thread.
+    *
+    * Chunks get about the same count of items. The first one is processed
+    * on the calling thread, and this function returns once all chunks have
+    * been processed. Exceptions thrown by func are rethrown on the calling
+    * thread, the one of the first failing chunk.
+    */
+    template<class FuncT>
+    void parallel_for_chunks(const std::size_t count, const std::size_t chunks_count, FuncT&& func)
+    {
+        if (chunks_count <= 1) [[unlikely]] {
+            func(std::size_t(0), std::size_t(0), count);
+            return;
+        }
 
-        virtual ~StartStepSlice() noexcept = default;  //!< Default destructor.
+        std::vector<std::exception_ptr> errors(chunks_count);
+        const auto run_chunk = [&func, &errors, count, chunks_count](const std::size_t chunk) {
+            try {
+                func(chunk, count * chunk / chunks_count, count * (chunk + 1) / chunks_count);
+            }
+            catch (...) {
+                errors[chunk] = std::current_exception();
+            }
+        };
 
-    };
+        {
+            std::vector<std::jthread> threads{};
+            threads.reserve(chunks_count - 1);
+            for (std::size_t chunk = 1; chunk < chunks_count; ++chunk)
+                threads.emplace_back(run_chunk, chunk);
+            run_chunk(0);
+        }   // threads get joined here
+
+        for (const std::exception_ptr& error : errors)
+            if (error) [[unlikely]]
+                std::rethrow_exception(error);
+    }
 
 
-    /** \brief Class of slices with default start values. */
-    template<typename IntT>
-        requires std::is_signed_v<IntT>
-    struct StopStepSlice : public Slice<IntT>
+    //=====   templated chars classes   ===========================
+    //---   fold_case()   -----------------------------------------
+    /** \brief Returns the case folded form of character ch, for case-insensitive comparisons.
+    *
+    * ASCII uppercase letters get lowered. Other chars, e.g. the code units
+    * of UTF-8 sequences, are returned as is.  Other wider characters get
+    * their simple Unicode case folding,  i.e. the lowercase form of their
+    * uppercase form as std::towupper() and std::towlower() provide them in
+    * the current locale, so that e.g. final and non-final sigmas match.
+    */
+    template<class CharT>
+    [[nodiscard]]
+    inline const CharT fold_case(const CharT ch) noexcept
     {
-        using MyBaseClass = Slice<IntT>;
+        using uchar_type = std::make_unsigned_t<CharT>;
+        const uchar_type code{ uchar_type(ch) };
+        if (code < 0x80) [[likely]]
+            return (code >= 'A' && code <= 'Z') ? CharT(code | 0x20) : ch;
 
-        //---   Constructors / Destructor   -------------------
-        inline StopStepSlice(const IntT stop = MyBaseClass::DEFAULT, const IntT step = MyBaseClass::DEFAULT) noexcept   //!< Valued constructor
-            : MyBaseClass(MyBaseClass::DEFAULT, stop, step)
-        {}
+        if constexpr (sizeof(CharT) == 1)
+            return ch;
+        else {
+            if (code > std::numeric_limits<std::make_unsigned_t<wchar_t>>::max()) [[unlikely]]
+                return ch;
+            return CharT(std::towlower(std::towupper(std::wint_t(code))));
+        }
+    }
 
-        virtual ~StopStepSlice() noexcept = default;  //!< Default destructor.
-    };
+    /** \brief Returns the eight chars packed in word with their ASCII uppercase letters lowered, as fold_case() does with each of them.
+    *
+    * All the eight chars get processed at once, with no branch: the bytes
+    * that are ASCII and that are from 'A' up to 'Z' get their bit 0x20 set.
+    */
+    [[nodiscard]]
+    inline std::uint64_t fold_ascii_case(const std::uint64_t word) noexcept
+    {
+        constexpr std::uint64_t ONES{ 0x0101'0101'0101'0101ull };
+        constexpr std::uint64_t LOW7{ 0x7f7f'7f7f'7f7f'7f7full };
+        const std::uint64_t low7{ word & LOW7 };
+        const std::uint64_t above_Z{ low7 + ONES * (0x7f - 'Z') };     // bit 7 set in bytes greater than 'Z'
+        const std::uint64_t from_A{ low7 + ONES * (0x80 - 'A') };      // bit 7 set in bytes greater than or equal to 'A'
+        const std::uint64_t uppers{ (from_A ^ above_Z) & ~word & (ONES * 0x80) };
+        return word | (uppers >> 2);
+    }
 
 
-    //=====   templated chars classes   ===========================
     //---   is_alpha()   ------------------------------------------
     /** \brief SHOULD NEVER BE USED. Use next specializations instead. */
     template<class CharT>
@@ -2491,3 +8931,332 @@ namespace pcs // i.e. "pythonic c++ strings"
 #endif
 
 } // end of namespace pcs  // (pythonic c++ strings)
+
+
+//=====   std::hash specializations   =============================
+/** \brief Hashing of interned strings handles, returns the hash value that has been computed once when interning. */
+template<class CharT, class TraitsT>
+struct std::hash<pcs::CppInternedT<CharT, TraitsT>>
+{
+    [[nodiscard]]
+    inline std::size_t operator() (const pcs::CppInternedT<CharT, TraitsT>& interned) const noexcept
+    {
+        return interned.hash();
+    }
+};
+
+
+/** \brief Hashing of strings, as pcs::HashT does. */
+template<class CharT, class TraitsT, class AllocatorT>
+struct std::hash<pcs::CppStringT<CharT, TraitsT, AllocatorT>>
+{
+    [[nodiscard]]
+    inline std::size_t operator() (const pcs::CppStringT<CharT, TraitsT, AllocatorT>& str) const noexcept
+    {
+        return pcs::HashT<CharT, TraitsT>{}(std::basic_string_view<CharT, TraitsT>(str));
+    }
+};
+
+/** \brief Hashing of hashed strings, returns the hash value that gets cached by the string. */
+template<class CharT, class TraitsT, class AllocatorT>
+struct std::hash<pcs::CppHashedStringT<CharT, TraitsT, AllocatorT>>
+{
+    [[nodiscard]]
+    inline std::size_t operator() (const pcs::CppHashedStringT<CharT, TraitsT, AllocatorT>& str) const noexcept
+    {
+        return str.hash();
+    }
+};
+
+
+//=====   std::formatter specializations   ========================
+/** \brief Formatting of CppStringT arguments, with the Python format-spec mini-language for strings.
+*
+* Format specs are [[fill]align][0][width][.precision][type], as in Python:
+* align is one of '<' (the default), '>' and '^', fill is any character
+* but '{' and '}', width and precision may be nested replacement fields,
+* e.g. "{:*^{}}",  and precision truncates the string.  Type 's' is the
+* default one, while type 'r' formats the Python representation of the
+* string, i.e. quoted and with escaped control characters: Python '!r'
+* conversions cannot be parsed within std::format() replacement fields.
+* Signs, alternate forms and groupings raise std::format_error,  which
+* makes them compile-time errors. Widths and precisions are counted in
+* code points, UTF-8 and UTF-16 strings being decoded. Paddings are
+* written straight into the output iterator, without temporary strings.
+*/
+template<class CharT, class TraitsT, class AllocatorT>
+struct std::formatter<pcs::CppStringT<CharT, TraitsT, AllocatorT>, CharT>
+{
+public:
+    using string_type = pcs::CppStringT<CharT, TraitsT, AllocatorT>;
+    using view_type   = std::basic_string_view<CharT, TraitsT>;
+
+    /** \brief Parses the format spec, which must comply with the Python format-spec mini-language for strings. */
+    constexpr auto parse(std::basic_format_parse_context<CharT>& ctx)
+    {
+        auto it{ ctx.begin() };
+        const auto end{ ctx.end() };
+        if (it == end || *it == CharT('}'))
+            return it;
+
+        // [[fill]align]
+        const std::size_t fill_size{ _code_point_size(*it) };
+        if (std::size_t(end - it) > fill_size && _is_align(it[fill_size])) {
+            if (*it == CharT('{') || *it == CharT('}'))
+                throw std::format_error("Invalid fill character in string format specifier");
+            std::copy(it, it + fill_size, m_fill);
+            m_fill_size = fill_size;
+            m_has_fill = true;
+            it += fill_size;
+        }
+        if (it != end && _is_align(*it)) {
+            if (*it == CharT('='))
+                throw std::format_error("'=' alignment not allowed in string format specifier");
+            m_align = *it++;
+        }
+
+        if (it != end && (*it == CharT('+') || *it == CharT('-') || *it == CharT(' ')))
+            throw std::format_error("Sign not allowed in string format specifier");
+        if (it != end && *it == CharT('#'))
+            throw std::format_error("Alternate form (#) not allowed in string format specifier");
+
+        // [0][width]
+        if (it != end && *it == CharT('0')) {
+            if (!m_has_fill)
+                m_fill[0] = CharT('0');
+            ++it;
+        }
+        it = _parse_size(it, end, ctx, m_width, m_width_is_arg);
+
+        if (it != end && (*it == CharT(',') || *it == CharT('_')))
+            throw std::format_error("Cannot specify a grouping option with strings");
+
+        // [.precision]
+        if (it != end && *it == CharT('.')) {
+            ++it;
+            if (it == end || !(*it == CharT('{') || (*it >= CharT('0') && *it <= CharT('9'))))
+                throw std::format_error("Format specifier missing precision");
+            it = _parse_size(it, end, ctx, m_precision, m_precision_is_arg);
+        }
+
+        // [type]
+        if (it != end && (*it == CharT('s') || *it == CharT('r')))
+            m_repr = (*it++ == CharT('r'));
+        if (it != end && *it != CharT('}'))
+            throw std::format_error("Unknown format code for object of type string");
+
+        return it;
+    }
+
+    /** \brief Formats str into the output of ctx, according to the parsed format spec. */
+    template<class FormatContextT>
+    auto format(const string_type& str, FormatContextT& ctx) const
+    {
+        const std::size_t width{ m_width_is_arg ? _arg_value(ctx, m_width) : m_width };
+        const std::size_t precision{ m_precision_is_arg ? _arg_value(ctx, m_precision) : m_precision };
+        const view_type text(str);
+
+        if (!m_repr) {
+            const view_type truncated{ text.substr(0, _code_points_prefix_size(text, precision)) };
+            return _write_padded(ctx.out(), width, _code_points_count(truncated), [truncated](auto out) {
+                return std::copy(truncated.cbegin(), truncated.cend(), out);
+            });
+        }
+        else {
+            const bool double_quoted{ text.find(CharT('\'')) != view_type::npos && text.find(CharT('"')) == view_type::npos };
+            const CharT quote{ double_quoted ? CharT('"') : CharT('\'') };
+            std::size_t length{ 0 };
+            _for_each_repr_piece(text, quote, precision, [&length](const view_type, const std::size_t code_points_count) {
+                length += code_points_count;
+            });
+            return _write_padded(ctx.out(), width, length, [&](auto out) {
+                _for_each_repr_piece(text, quote, precision, [&out](const view_type piece, const std::size_t) {
+                    out = std::copy(piece.cbegin(), piece.cend(), out);
+                });
+                return out;
+            });
+        }
+    }
+
+
+private:
+    static constexpr std::size_t NO_PRECISION{ std::size_t(-1) };
+
+    CharT       m_fill[4]{ CharT(' ') };
+    std::size_t m_fill_size{ 1 };
+    std::size_t m_width{ 0 };
+    std::size_t m_precision{ NO_PRECISION };
+    CharT       m_align{ CharT('<') };
+    bool        m_has_fill{ false };
+    bool        m_width_is_arg{ false };
+    bool        m_precision_is_arg{ false };
+    bool        m_repr{ false };
+
+    /** \brief Returns true if ch is one of the Python alignment characters, or false otherwise. */
+    [[nodiscard]]
+    static constexpr bool _is_align(const CharT ch) noexcept
+    {
+        return ch == CharT('<') || ch == CharT('>') || ch == CharT('^') || ch == CharT('=');
+    }
+
+    /** \brief Returns true if ch is a continuation code unit, i.e. not the first one of its code point, with UTF-8 and UTF-16 strings. */
+    [[nodiscard]]
+    static constexpr bool _is_continuation(const CharT ch) noexcept
+    {
+        using uchar_type = std::make_unsigned_t<CharT>;
+        if constexpr (sizeof(CharT) == 1)
+            return (uchar_type(ch) & 0xc0) == 0x80;
+        else if constexpr (sizeof(CharT) == 2)
+            return uchar_type(ch) >= 0xdc00 && uchar_type(ch) <= 0xdfff;
+        else
+            return false;
+    }
+
+    /** \brief Returns the count of code units of the code point that starts with code unit lead. */
+    [[nodiscard]]
+    static constexpr std::size_t _code_point_size(const CharT lead) noexcept
+    {
+        using uchar_type = std::make_unsigned_t<CharT>;
+        if constexpr (sizeof(CharT) == 1)
+            return (uchar_type(lead) >= 0xf0) ? 4 : (uchar_type(lead) >= 0xe0) ? 3 : (uchar_type(lead) >= 0xc0) ? 2 : 1;
+        else if constexpr (sizeof(CharT) == 2)
+            return (uchar_type(lead) >= 0xd800 && uchar_type(lead) <= 0xdbff) ? 2 : 1;
+        else
+            return 1;
+    }
+
+    /** \brief Returns the count of code points in text. */
+    [[nodiscard]]
+    static constexpr std::size_t _code_points_count(const view_type text) noexcept
+    {
+        return std::size_t(std::count_if(text.cbegin(), text.cend(), [](const CharT ch) { return !_is_continuation(ch); }));
+    }
+
+    /** \brief Returns the count of code units of the max_count first code points of text. */
+    [[nodiscard]]
+    static constexpr std::size_t _code_points_prefix_size(const view_type text, std::size_t max_count) noexcept
+    {
+        for (std::size_t index = 0; index < text.size(); ++index) {
+            if (!_is_continuation(text[index]) && max_count-- == 0)
+                return index;
+        }
+        return text.size();
+    }
+
+    /** \brief Parses a width or a precision, either an integer or a nested replacement field, the index of which gets set in value. */
+    template<class IteratorT>
+    static constexpr IteratorT _parse_size(IteratorT it, const IteratorT end, std::basic_format_parse_context<CharT>& ctx, std::size_t& value, bool& is_arg)
+    {
+        if (it != end && *it == CharT('{')) {
+            ++it;
+            if (it != end && *it == CharT('}')) {
+                value = ctx.next_arg_id();
+            }
+            else {
+                std::size_t arg_id{ 0 };
+                while (it != end && *it >= CharT('0') && *it <= CharT('9'))
+                    arg_id = arg_id * 10 + std::size_t(*it++ - CharT('0'));
+                if (it == end || *it != CharT('}'))
+                    throw std::format_error("Invalid nested replacement field in string format specifier");
+                ctx.check_arg_id(arg_id);
+                value = arg_id;
+            }
+            is_arg = true;
+            return ++it;
+        }
+
+        if (it != end && *it >= CharT('0') && *it <= CharT('9')) {
+            value = 0;
+            while (it != end && *it >= CharT('0') && *it <= CharT('9'))
+                value = value * 10 + std::size_t(*it++ - CharT('0'));
+        }
+        return it;
+    }
+
+    /** \brief Returns the value of the arg_id-th argument of ctx, which must be a non-negative integer. */
+    template<class FormatContextT>
+    [[nodiscard]]
+    static std::size_t _arg_value(FormatContextT& ctx, const std::size_t arg_id)
+    {
+        return std::visit_format_arg([](const auto value) -> std::size_t {
+            using value_type = std::remove_cvref_t<decltype(value)>;
+            if constexpr (std::is_integral_v<value_type> && !std::is_same_v<value_type, bool> && !std::is_same_v<value_type, CharT>) {
+                if constexpr (std::is_signed_v<value_type>) {
+                    if (value < 0)
+                        throw std::format_error("Negative width or precision in string format specifier");
+                }
+                return std::size_t(value);
+            }
+            else {
+                throw std::format_error("Width or precision is not an integer in string format specifier");
+            }
+        }, ctx.arg(arg_id));
+    }
+
+    /** \brief Calls func(piece, code_points_count) with the successive pieces of the Python representation of text, truncated to max_count code points. */
+    template<class FuncT>
+    static void _for_each_repr_piece(const view_type text, const CharT quote, std::size_t max_count, FuncT&& func)
+    {
+        using uchar_type = std::make_unsigned_t<CharT>;
+        constexpr char HEX_DIGITS[]{ "0123456789abcdef" };
+        bool last_emitted{ true };  // i.e. the first code unit of the current code point has been emitted
+
+        const auto emit = [&](const view_type piece, const bool is_continuation) {
+            if (is_continuation) {
+                if (last_emitted)
+                    func(piece, 0);
+                return;
+            }
+            const std::size_t count{ std::min(piece.size(), max_count) };
+            if (count > 0)
+                func(piece.substr(0, count), count);
+            max_count -= count;
+            last_emitted = (count > 0);
+        };
+
+        emit(view_type(&quote, 1), false);
+        for (const CharT& ch : text) {
+            const uchar_type uch{ uchar_type(ch) };
+            CharT escaped[4]{ CharT('\\'), ch, CharT(), CharT() };
+            std::size_t escaped_size{ 2 };
+            if (ch == CharT('\t'))
+                escaped[1] = CharT('t');
+            else if (ch == CharT('\n'))
+                escaped[1] = CharT('n');
+            else if (ch == CharT('\r'))
+                escaped[1] = CharT('r');
+            else if (uch < 0x20 || uch == 0x7f || (sizeof(CharT) > 1 && uch >= 0x80 && uch <= 0x9f)) {
+                escaped[1] = CharT('x');
+                escaped[2] = CharT(HEX_DIGITS[(uch >> 4) & 0xf]);
+                escaped[3] = CharT(HEX_DIGITS[uch & 0xf]);
+                escaped_size = 4;
+            }
+            else if (ch != CharT('\\') && ch != quote) {
+                emit(view_type(&ch, 1), _is_continuation(ch));
+                continue;
+            }
+            emit(view_type(escaped, escaped_size), false);
+        }
+        emit(view_type(&quote, 1), false);
+    }
+
+    /** \brief Writes into out the text written by write(out), which is length code points long, padded up to width code points according to the alignment. Returns the iterator past the last output character. */
+    template<class OutputIt, class WriteFuncT>
+    OutputIt _write_padded(OutputIt out, const std::size_t width, const std::size_t length, WriteFuncT&& write) const
+    {
+        const std::size_t padding{ (width > length) ? width - length : 0 };
+        const std::size_t before{ (m_align == CharT('>')) ? padding : (m_align == CharT('^')) ? padding / 2 : 0 };
+
+        const auto fill = [this](OutputIt out, const std::size_t count) {
+            if (m_fill_size == 1) [[likely]]
+                return std::fill_n(out, count, m_fill[0]);
+            for (std::size_t index = 0; index < count; ++index)
+                out = std::copy(m_fill, m_fill + m_fill_size, out);
+            return out;
+        };
+
+        out = fill(out, before);
+        out = write(out);
+        return fill(out, padding - before);
+    }
+};